@@ -6,7 +6,7 @@ then
     exit $?
 fi
 
-EXECSTRING="root -l /gluster2/h_popp01/Delphi/macros/normalize_weightSum.C'(\"${1}\")'"
+EXECSTRING="/gluster2/h_popp01/Delphi/normalize ${1}"
 echo $EXECSTRING
 eval $EXECSTRING
 
@@ -0,0 +1,39 @@
+#ifndef EXCLUDELIST_H
+#define EXCLUDELIST_H
+
+// exclusion lists of job outputs, e.g. written by find_bad_runs:
+// one file per line, everything after the first whitespace (e.g. "# reason") and lines starting with # are ignored
+
+#include <string>
+#include <vector>
+#include <set>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+
+inline bool ReadExcludeList(const char *listName, std::set<std::string> &excluded){
+  std::ifstream list(listName);
+  if( !list.is_open() ){
+    printf("ReadExcludeList: could not open %s\n", listName);
+    return false;
+  }
+  std::string line, fileName;
+  while( std::getline(list, line) ){
+    std::istringstream tokens(line);
+    if( !(tokens >> fileName) || fileName[0] == '#' ) continue;
+    excluded.insert(fileName);
+  }
+  return true;
+}
+
+// removes the excluded files, returns the number of removed files
+inline int ApplyExcludeList(std::vector<std::string> &files, const std::set<std::string> &excluded){
+  std::vector<std::string> kept;
+  for(unsigned int i = 0; i < files.size(); i++)
+    if( !excluded.count(files.at(i)) ) kept.push_back(files.at(i));
+  int nRemoved = files.size() - kept.size();
+  files.swap(kept);
+  return nRemoved;
+}
+
+#endif
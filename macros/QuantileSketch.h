@@ -0,0 +1,96 @@
+#ifndef QUANTILESKETCH_H
+#define QUANTILESKETCH_H
+
+// mergeable quantile sketch with relative accuracy (log-spaced buckets, cf. DDSketch):
+// every quantile is returned within a relative error alpha of a value of the input,
+// memory grows only with the number of decades covered, not with the number of values;
+// sketches filled in parallel (e.g. per thread or per file group) can be merged exactly
+
+#include <map>
+#include <vector>
+#include <cmath>
+
+class QuantileSketch{
+
+ public:
+
+  QuantileSketch(double alpha = 0.01) : gamma((1.+alpha)/(1.-alpha)), logGamma(log(gamma)), nZero(0.), nTotal(0.) {};
+
+  void Add(double x, double n = 1.){
+    if( fabs(x) < minValue ) nZero += n;
+    else if( x > 0. ) positive[Index(x)] += n;
+    else negative[Index(-x)] += n;
+    nTotal += n;
+  };
+
+  void Merge(const QuantileSketch &other){
+    for(std::map<int,double>::const_iterator it = other.positive.begin(); it != other.positive.end(); ++it) positive[it->first] += it->second;
+    for(std::map<int,double>::const_iterator it = other.negative.begin(); it != other.negative.end(); ++it) negative[it->first] += it->second;
+    nZero += other.nZero;
+    nTotal += other.nTotal;
+  };
+
+  double Count() const { return nTotal; };
+
+  // q in [0,1], 0 for an empty sketch
+  double Quantile(double q) const{
+    if( nTotal <= 0. ) return 0.;
+    double rank = q*(nTotal-1.);
+    double cumulative = 0.;
+    for(std::map<int,double>::const_reverse_iterator it = negative.rbegin(); it != negative.rend(); ++it){
+      cumulative += it->second;
+      if( cumulative > rank ) return -Value(it->first);
+    }
+    cumulative += nZero;
+    if( cumulative > rank ) return 0.;
+    for(std::map<int,double>::const_iterator it = positive.begin(); it != positive.end(); ++it){
+      cumulative += it->second;
+      if( cumulative > rank ) return Value(it->first);
+    }
+    return positive.size() ? Value(positive.rbegin()->first) : 0.;
+  };
+
+  // sketch of |x - center|, e.g. MAD = AbsDeviation(Quantile(0.5)).Quantile(0.5)
+  QuantileSketch AbsDeviation(double center) const{
+    QuantileSketch dev(*this);
+    dev.positive.clear();
+    dev.negative.clear();
+    dev.nZero = 0.;
+    dev.nTotal = 0.;
+    for(std::map<int,double>::const_iterator it = positive.begin(); it != positive.end(); ++it) dev.Add(fabs(Value(it->first) - center), it->second);
+    for(std::map<int,double>::const_iterator it = negative.begin(); it != negative.end(); ++it) dev.Add(fabs(-Value(it->first) - center), it->second);
+    dev.Add(fabs(center), nZero);
+    return dev;
+  };
+
+  // representative value and count of every non-empty bucket in increasing order, e.g. to histogram the distribution
+  void Buckets(std::vector<double> &values, std::vector<double> &counts) const{
+    values.clear();
+    counts.clear();
+    for(std::map<int,double>::const_reverse_iterator it = negative.rbegin(); it != negative.rend(); ++it){
+      values.push_back(-Value(it->first));
+      counts.push_back(it->second);
+    }
+    if( nZero > 0. ){
+      values.push_back(0.);
+      counts.push_back(nZero);
+    }
+    for(std::map<int,double>::const_iterator it = positive.begin(); it != positive.end(); ++it){
+      values.push_back(Value(it->first));
+      counts.push_back(it->second);
+    }
+  };
+
+ private:
+
+  int Index(double x) const { return (int)ceil(log(x)/logGamma); }; // bucket (gamma^(i-1), gamma^i]
+  double Value(int i) const { return 2.*pow(gamma, i)/(gamma+1.); }; // relative error <= alpha within the bucket
+
+  double gamma, logGamma;
+  std::map<int,double> positive, negative; // bucket index -> count
+  double nZero, nTotal;
+
+  static constexpr double minValue = 1e-300; // treated as zero
+};
+
+#endif
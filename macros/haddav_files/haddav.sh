@@ -1,31 +1,20 @@
 #!/bin/bash
 
-STR="./haddav"
+# average the outputs 1.root ... ${2}.root into result.root using ${1} merge threads
+# (haddav merges in parallel groups and partial files by itself, no shell batches needed)
 
-DIV=$((${2}/${1}))
-echo "make one batch from $DIV files"
+if [ "$#" -lt "2" ];
+then
+    echo "Usage: $0 [number of threads] [number of files]"
+    exit 1
+fi
 
-for j in `seq 1 $1`;
+STR="./haddav -j ${1} result.root"
+for i in `seq 1 ${2}`;
 do
-    INT1=$(( ${DIV}*(${j}-1)+1 ))
-    echo $INT1
-    INT2=$(( ${DIV}*${j} ))
-    echo $INT2
-
-    STR="$STR out_$j.root"
-    for i in `seq $INT1 $INT2`;
-    do
-        STR="$STR $i.root "
-    done
-    STR="$STR &"
-    echo $STR
-    eval $STR
-
-    sleep 2
-    
-    unset STR
-    STR="./haddav"
-    
+    STR="$STR $i.root"
 done
+echo $STR
+eval $STR
 
 exit $?
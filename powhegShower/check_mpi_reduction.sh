@@ -0,0 +1,26 @@
+#!/bin/bash
+
+# check of the MPI mode: the output of "mpirun -np 2 ./ShowerAnalysis_mpi" has to equal the sum (hadd) of two single runs
+# with the same campaign seed (task = rank) and LHE files; needs ShowerAnalysis and ShowerAnalysis_mpi (make both)
+#
+# ./check_mpi_reduction.sh BOOST "pwgevents-%04d.lhe"   (files 1 and 2 are used, as by ranks 0 and 1)
+
+if [ "$#" -lt "2" ];
+then
+    echo "Usage: $0 BOOST \"pwgevents-%04d.lhe\""
+    exit 1
+fi
+
+BOOST=$1
+LHEPATTERN=$2
+export SEED=${SEED:-12345}
+
+mpirun -np 2 ./ShowerAnalysis_mpi mpicheck_mpi.root ${BOOST} "${LHEPATTERN}" > mpicheck_mpi.log 2>&1 || { echo "MPI run failed, see mpicheck_mpi.log"; exit 1; }
+for RANK in 0 1; do
+    SLURM_ARRAY_TASK_ID=${RANK} ./ShowerAnalysis mpicheck_single${RANK}.root ${BOOST} $(printf "${LHEPATTERN}" $((RANK+1))) > mpicheck_single${RANK}.log 2>&1 || { echo "single run ${RANK} failed, see mpicheck_single${RANK}.log"; exit 1; }
+done
+hadd -f mpicheck_sum.root mpicheck_single0.root mpicheck_single1.root > /dev/null
+
+root -l -b -q "macros/compare_outputs.C(\"mpicheck_mpi.root\",\"mpicheck_sum.root\")" | tee mpicheck.log
+grep -q "compare_outputs: OK" mpicheck.log
+exit $?
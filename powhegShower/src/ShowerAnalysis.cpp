@@ -33,6 +33,11 @@ double GetUEPtDensity(Event &event, int iPhoton);
 int main(int, char **);
 int main(int argc, char **argv) {
 
+  // MPI mode (ShowerAnalysis_mpi): every rank showers its own LHE file, a "%d" in the file name is replaced
+  // by rank+1 (e.g. pwgevents-%04d.lhe -> pwgevents-0001.lhe, ...); rank 0 writes the summed histograms
+  // (as hadd of the rank outputs, normalized afterwards like a single job output)
+  pyHelp.Init_MPI(&argc, &argv);
+
   string fileName; Pythia p; bool loadhooks;
   QEDQCDPowhegHooks *powhegHooks = 0; // POWHEG UserHooks
   p.readFile("shower.conf");
@@ -75,6 +80,8 @@ int main(int argc, char **argv) {
   h_nEvents->GetXaxis()->SetBinLabel(3, "bornveto2.0");
   h_nEvents->GetXaxis()->SetBinLabel(4, "bornveto3.0");
   h_nEvents->GetXaxis()->SetBinLabel(5, "bornveto4.0");
+  TH1D *h_weightSum_genInfo = pyHelp.Book_Generator_Info("h_weightSum_genInfo");
+  double sumW2 = 0.;
   
   // prepare bookkeeping of weights
   //----------------------------------------------------------------------
@@ -120,20 +127,78 @@ int main(int argc, char **argv) {
   
   //----------------------------------------------------------------------
   fileName = argv[3];
+  if( pyHelp.Get_MPI_Size() > 1 ){
+    if( fileName.find('%') != string::npos ) fileName = Form(argv[3], pyHelp.Get_MPI_Rank()+1);
+    else if( pyHelp.Get_MPI_Rank() == 0 ) printf("MPI mode: all ranks shower %s (with different seeds)\n", fileName.c_str());
+    if( !pyHelp.Set_Campaign_Seed(Form("%d", pyHelp.Get_MPI_Rank())) )
+      exit(EXIT_FAILURE);
+    pyHelp.Set_Stream_Seed(p, 0);
+  }
+  else if( getenv("SEED") ){ // task = SLURM_ARRAY_TASK_ID, the same stream as MPI rank SLURM_ARRAY_TASK_ID
+    if( !pyHelp.Set_Campaign_Seed("") )
+      exit(EXIT_FAILURE);
+    pyHelp.Set_Stream_Seed(p, 0);
+  }
   printf("Showering events in %s\n",fileName.c_str());
+
+  // TIMING = 1: time per stage (init, generation, leading photon and Born veto = fills, jets + photons = gammaJet, write)
+  // in the tree "timing" of the output; PERFCOUNTERS = 1: hardware counters per stage as well
+  bool usePerfCounters = getenv("PERFCOUNTERS") && strcmp(getenv("PERFCOUNTERS"),"0");
+  bool useTiming = (getenv("TIMING") && strcmp(getenv("TIMING"),"0")) || usePerfCounters; // tested at every stage
+  if(useTiming) pyHelp.Enable_Timing();
+  if(usePerfCounters) pyHelp.Enable_Perf_Counters();
+  pyHelp.Start_Timing_Bin(0);
+  if(useTiming) pyHelp.Start_Stage(PythiaAnalysisHelper::kInit);
   p.readString("Beams:LHEF = " + fileName);
   p.init();
+  if(useTiming) pyHelp.Stop_Stage(PythiaAnalysisHelper::kInit);
+
+  // WEIGHTLOG = 1: event number, pTHat, uborns, leading photon pT and weights of every event to weightlog_<output>
+  // (seed 0: no per-event seeds, the event number locates the event in the LHE file),
+  // logged before the Born veto (vetoed = above 2.5 uborns), so all veto factors can be re-evaluated offline
+  bool useWeightLog = getenv("WEIGHTLOG") && strcmp(getenv("WEIGHTLOG"),"0");
+  if(useWeightLog){
+    TString weightLogName = rootFileName;
+    weightLogName.Insert(weightLogName.Last('/')+1, pyHelp.Get_MPI_Size() > 1 ? Form("weightlog_rank%d_", pyHelp.Get_MPI_Rank()) : "weightlog_");
+    if( !pyHelp.Open_Weight_Log(weightLogName) )
+      exit(EXIT_FAILURE);
+  }
+
+  // PROGRESS = interval in seconds: progress lines (events, rate, Born veto acceptance, projected end, memory)
+  // to progress_<output>.txt, the total is the number of events in the LHE file (see progress_summary.sh)
+  if( getenv("PROGRESS") ){
+    TString progressName = rootFileName;
+    progressName.Insert(progressName.Last('/')+1, pyHelp.Get_MPI_Size() > 1 ? Form("progress_rank%d_", pyHelp.Get_MPI_Rank()) : "progress_");
+    progressName.Replace(progressName.Last('.'), progressName.Length(), ".txt");
+    long nEventsLHE = pyHelp.Count_LHE_Events(fileName.c_str());
+    if( !pyHelp.Open_Progress(progressName, strtol(getenv("PROGRESS"), NULL, 10), TMath::Min(nEventsLHE, 1000000L)) )
+      exit(EXIT_FAILURE);
+    pyHelp.Progress_Bin(0, TMath::Min(nEventsLHE, 1000000L));
+  }
 
   // skip pythia errors and break, when showering has reached the end of the LHE file
   //----------------------------------------------------------------------
+  // DEADLINE = seconds (or SIGTERM/SIGUSR1/SIGUSR2): stop showering early, the output is normalized by the events done
+  bool useDeadline = pyHelp.Set_Deadline();
+  if(useDeadline) pyHelp.Start_Deadline_Bin(1);
   int counter = 0;
   while (counter++ < 1000000) {
-    if (!p.next()) {
+    if( useDeadline && pyHelp.Is_Deadline_Reached() ){
+      printf("stopping after %.0f events (deadline)\n", h_nEvents->GetBinContent(2));
+      break;
+    }
+    if(useTiming) pyHelp.Start_Stage(PythiaAnalysisHelper::kGeneration);
+    bool isGenerated = p.next();
+    if(useTiming) pyHelp.Stop_Stage(PythiaAnalysisHelper::kGeneration);
+    if (!isGenerated) {
       if (p.info.atEndOfFile()) break;
       continue;
     }
 
     bool veto_born_30 = false;
+    sumW2 += p.info.weight()*p.info.weight();
+    pyHelp.Progress_Event();
+    pyHelp.Count_Event();
     
     p.event.bst(0., 0., boostBetaZ);
     if(h_nEvents->GetBinContent(2) == 1)
@@ -200,6 +265,7 @@ int main(int argc, char **argv) {
       vec_weights.push_back(p.info.getWeightsDetailedValue(vec_weightsID.at(i)) * sudaWeight);
  
     // The actual event analysis starts here.
+    if(useTiming) pyHelp.Start_Stage(PythiaAnalysisHelper::kFills);
     ptMax  = -1.;
     ptTemp = -1.;
     iPhoton = -1;
@@ -231,6 +297,9 @@ int main(int argc, char **argv) {
       }
     }
       
+    bool isBornVetoed = iPhoton > 0 && ptMax > p.info.getScalesAttribute("uborns")*2.5;
+    if(useWeightLog) pyHelp.Log_Event_Weights(counter, 0, p.info.pTHat(), p.info.getScalesAttribute("uborns"), ptMax, vec_weights, 0, isBornVetoed);
+
     if(iPhoton > 0){
       // vary born veto to check if enough/too much is cut away
       pyHelp.FillForEachWeight(vec_directphoton_pt_leading_bornveto00, p.event[iPhoton].pT(), vec_weights);
@@ -248,14 +317,19 @@ int main(int argc, char **argv) {
 
       // use following line to ignore events with extreme weights that can cause ugly fluctuations
       // but make sure the cross section does not decrease significantly
-      if(ptMax > p.info.getScalesAttribute("uborns")*2.5){
+      if(isBornVetoed){
 	h_nEvents->Fill(1.,-1.);
+	pyHelp.Progress_Veto();
+	if(useTiming) pyHelp.Stop_Stage(PythiaAnalysisHelper::kFills);
 	continue; // jump to next event = veto event if hardest photon is x times harder than born scale
       }
     }
       
+    if(useTiming) pyHelp.Stop_Stage(PythiaAnalysisHelper::kFills);
+
     // set up pseudojets and set up background density in eta band
     //----------------------------------------------------------------------
+    PythiaAnalysisHelper::Stage_Timer timer(pyHelp, PythiaAnalysisHelper::kGammaJet, useTiming); // jets, isolation and photon-jet correlations up to the end of the event
     for (int i = 5; i < p.event.size(); i++) {
       if( i == iPhoton ) continue; // never consider the photon itself for the jet
       if (p.event[i].isFinal() && p.event[i].isCharged()) {
@@ -349,11 +423,40 @@ int main(int argc, char **argv) {
 
   // statistics on event generation
   p.stat();
+  if(useWeightLog) pyHelp.Close_Weight_Log();
+
+  pyHelp.Fill_Generator_Info(h_weightSum_genInfo, p.info, sumW2);
+
+  // MPI: histograms of all ranks summed into rank 0, which writes the output
+  // (the spectra are vector<TH1D>, i.e. in no directory, so they are passed explicitly)
+  if( pyHelp.Get_MPI_Size() > 1 ){
+    vector< vector<TH1D>* > vec_spectra = {&vec_directphoton_pt, &vec_directphoton_pt_FOCAL, &vec_directphoton_pt_leading,
+                                           &vec_directphoton_pt_leading_bornveto00, &vec_directphoton_pt_leading_bornveto20,
+                                           &vec_directphoton_pt_leading_bornveto30, &vec_directphoton_pt_leading_bornveto40,
+                                           &vec_isodirectphoton_pt, &vec_isodirectphoton_pt_marcoBinning, &vec_isodirectphoton_pt_bornveto30,
+                                           &vec_isodirectphoton_pt_leading, &vec_chjet_pt, &vec_chjet_pt_leading,
+                                           &vec_isoCone_track_phi, &vec_isoCone_track_eta, &vec_dPhiJetGamma, &vec_dPhiJetGamma_noDeltaPhiCut,
+                                           &vec_xJetGamma, &vec_chJetTrackMult, &vec_xObs_pGoing, &vec_xObs_PbGoing,
+                                           &vec_xBjorken_1, &vec_xBjorken_2, &vec_xSecTriggerGamma,
+                                           &vec_isoPt, &vec_UEPtDensity, &vec_isoPt_corrected};
+    vector<TH1*> histos;
+    for(unsigned int i = 0; i < vec_spectra.size(); i++)
+      for(unsigned int j = 0; j < vec_spectra.at(i)->size(); j++) histos.push_back(&vec_spectra.at(i)->at(j));
+    bool isReduced = pyHelp.Reduce_Histograms_MPI(histos);
+    if( !isReduced || pyHelp.Get_MPI_Rank() > 0 ){
+      pyHelp.Finalize_MPI();
+      if (powhegHooks) delete powhegHooks;
+      return isReduced ? 0 : 1;
+    }
+  }
 
   // write histograms to file ----------------------------------------
+  pyHelp.Start_Timing_Bin(-1);
+  if(useTiming) pyHelp.Start_Stage(PythiaAnalysisHelper::kWrite);
   TFile file(rootFileName, "RECREATE");
 
   h_nEvents->Write();
+  h_weightSum_genInfo->Write();
   
   double deltaRap = (etaDetector-jetRadius)*2.;
   pyHelp.Add_Histos_Scale_Write2File_Powheg(vec_directphoton_pt, file, deltaRap); // NB: always "width" scaling applied
@@ -385,7 +488,11 @@ int main(int argc, char **argv) {
   // pyHelp.Add_Histos_Scale_Write2File_Powheg(vec_isoPt_corrected, file, 1.);
   pyHelp.Add_Histos_Scale_Write2File_Powheg(vec_xSecTriggerGamma, file, 1.);
   
+  if(useTiming) pyHelp.Stop_Stage(PythiaAnalysisHelper::kWrite);
+  pyHelp.Write_Timing(file);
   file.Close();
+  pyHelp.Close_Progress();
+  pyHelp.Finalize_MPI();
 
   if (powhegHooks) delete powhegHooks;
   return 0;
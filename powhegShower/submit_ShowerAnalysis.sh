@@ -91,6 +91,28 @@ INDEX2=$((SLURM_ARRAY_TASK_ID*2))
 
 POWHEGPREFIX=/lustre/nyx/alice/users/hpoppenb/POWHEG-BOX-V2
 
+# end the generation gracefully 5 min before the time limit of the job (squeue %L = time left, [D-]HH:MM:SS)
+TIMELEFT=$(squeue -h -j ${SLURM_JOB_ID} -o %L 2>/dev/null)
+if [[ "${TIMELEFT}" =~ ^[0-9:-]+$ ]]; then
+    DAYS=0
+    if [[ "${TIMELEFT}" == *-* ]]; then
+        DAYS=${TIMELEFT%%-*}
+        TIMELEFT=${TIMELEFT#*-}
+    fi
+    SECONDSLEFT=0
+    IFS=: read -r -a TIMEFIELDS <<< "${TIMELEFT}"
+    for FIELD in "${TIMEFIELDS[@]}"; do
+        SECONDSLEFT=$((SECONDSLEFT*60 + 10#${FIELD}))
+    done
+    DEADLINE=$((DAYS*86400 + SECONDSLEFT - 300))
+    # less than 5 min left: stop right after the first event instead of reading 0 or less as no deadline
+    if [ ${DEADLINE} -lt 1 ]; then
+        echo "WARNING: only $((DAYS*86400 + SECONDSLEFT)) s left in the allocation, DEADLINE set to 1 s"
+        DEADLINE=1
+    fi
+    export DEADLINE
+fi
+
 STR1="time ./ShowerAnalysis $INDEX1.root ${POWHEGPREFIX}/directphoton/lhefGen/lhef/${BASEDIR}/${INDEX1}/pwgevents-0001.lhe &"
 STR2="time ./ShowerAnalysis $INDEX2.root ${POWHEGPREFIX}/directphoton/lhefGen/lhef/${BASEDIR}/${INDEX2}/pwgevents-0001.lhe"
 sleep 2
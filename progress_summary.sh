@@ -0,0 +1,64 @@
+#!/bin/bash
+
+# summary of the progress files (PROGRESS = interval) of all tasks of a campaign: the last line of every
+# progress_*.txt below DIR, one row per task sorted by projected end, with the campaign total at the bottom
+#
+# ./progress_summary.sh [DIR] [STRAGGLER]
+#
+# flags: STALE   = no line for more than 3 intervals (job killed or node lost; a job stuck in the generation keeps
+#                  reporting with rate 0, i.e. shows up as STUCK)
+#        STUCK   = running, but no event in the last interval
+#        SLOW    = projected end more than STRAGGLER (default: 1.5) times the median remaining time of the running tasks
+# kill or resubmit flagged tasks with host and pid of their row
+
+DIR=${1:-.}
+STRAGGLER=${2:-1.5}
+
+FILES=$(find ${DIR} -name "progress_*.txt" | sort)
+if [ -z "${FILES}" ]; then
+    echo "no progress_*.txt below ${DIR}"
+    exit 1
+fi
+
+NOW=$(date +%s)
+for FILE in ${FILES}; do
+    echo "file=${FILE} $(tail -n 1 ${FILE})"
+done | awk -v now=${NOW} -v straggler=${STRAGGLER} '
+{
+    for(i = 1; i <= NF; i++){ split($i, kv, "="); v[kv[1]] = kv[2] }
+    n++
+    file[n] = v["file"]; host[n] = v["host"]; pid[n] = v["pid"]; status[n] = v["status"]; bin[n] = v["bin"]
+    events[n] = v["events"]; total[n] = v["total"]; rate[n] = v["rate"]; accepted[n] = v["accepted"]
+    eta[n] = v["eta"]; rss[n] = v["rssMB"]; age[n] = now - v["time"]
+    flag[n] = ""
+    if(status[n] == "running"){
+        if(age[n] > 3*v["interval"]) flag[n] = "STALE"
+        else if(rate[n] == 0) flag[n] = "STUCK"
+        if(eta[n] > 0 && flag[n] == ""){ nRemaining++; remaining[nRemaining] = eta[n] - now }
+    }
+}
+END{
+    # median remaining time of the running tasks
+    for(i = 1; i <= nRemaining; i++)
+        for(j = i+1; j <= nRemaining; j++)
+            if(remaining[j] < remaining[i]){ t = remaining[i]; remaining[i] = remaining[j]; remaining[j] = t }
+    median = nRemaining ? remaining[int((nRemaining+1)/2)] : 0
+
+    printf("%-50s %-12s %8s %-8s %4s %12s %12s %9s %8s %9s %8s %6s %s\n", "file", "host", "pid", "status", "bin", "events", "total", "ev/s", "accepted", "left[min]", "rss[MB]", "age[s]", "flag")
+    fflush()
+    for(i = 1; i <= n; i++){
+        left = (eta[i] > 0 && status[i] == "running") ? (eta[i] - now)/60. : (status[i] == "done" ? 0 : -1)
+        if(flag[i] == "" && status[i] == "running" && median > 0 && eta[i] - now > straggler*median) flag[i] = "SLOW"
+        printf("%-50s %-12s %8s %-8s %4s %12s %12s %9.1f %8.4f %9.1f %8.1f %6d %s\n", file[i], host[i], pid[i], status[i], bin[i], events[i], total[i], rate[i], accepted[i], left, rss[i], age[i], flag[i]) | "sort -k10 -n"
+        sumEvents += events[i]; sumTotal += total[i]; sumRate += (status[i] == "running" ? rate[i] : 0)
+        if(status[i] == "done") nDone++
+        if(flag[i] != "") nFlagged++
+        if(eta[i] > lastEnd) lastEnd = eta[i]
+    }
+    close("sort -k10 -n")
+    printf("\n%d tasks: %d done, %d flagged; %d of %d events (%.1f%%), %.1f ev/s in total", n, nDone, nFlagged, sumEvents, sumTotal, sumTotal > 0 ? 100.*sumEvents/sumTotal : 0, sumRate)
+    if(lastEnd > now) printf(", projected end of the campaign in %.1f min", (lastEnd-now)/60.)
+    printf("\n")
+}'
+
+exit 0
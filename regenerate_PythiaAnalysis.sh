@@ -0,0 +1,26 @@
+#!/bin/bash
+
+# regeneration of single events of a PythiaAnalysis job that ran with EVENTSEEDS=1, e.g. the outliers of a weight spike:
+# only the listed events are generated (with full event listings in OUTPUT.log), no other events of the job are needed
+#
+# ./regenerate_PythiaAnalysis.sh EVENTLIST OUTPUT PROCESS NEVENTS CMENERGY [SHOWEROPT RENSCALE FACSCALE BOOSTZ PDF1 PDF2]
+# (same arguments and environment (PTBINNING etc.) as the original job)
+#
+# EVENTLIST has one event per line: "iBin iEvent seed", e.g. from the weight log of the job (WEIGHTLOG=1; without
+# EVENTSEEDS=1 the logged seed is 0 and the list is rejected):
+# root -l -b -q -e 'TFile f("weightlog_abc.root"); TTree *t = (TTree*)f.Get("weightLog"); Long64_t n = t->Draw("iBin:iEvent:seed", "weights[0] > 1e-3 && !vetoed", "goff");
+#   for(Long64_t i = 0; i < n; i++) printf("%.0f %.0f %.0f\n", t->GetV1()[i], t->GetV2()[i], t->GetV3()[i]);' > eventlist.txt
+
+if [ "$#" -lt "5" ];
+then
+    echo "Usage: $0 EVENTLIST OUTPUT PROCESS NEVENTS CMENERGY [further arguments of PythiaAnalysis]"
+    exit 1
+fi
+
+EVENTLIST=$1
+OUTPUT=$2
+shift 2
+
+REGENERATE=${EVENTLIST} ./PythiaAnalysis ${OUTPUT} "$@" > ${OUTPUT}.log 2>&1
+
+exit $?
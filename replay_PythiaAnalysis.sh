@@ -0,0 +1,28 @@
+#!/bin/bash
+
+# re-analysis of stored events (PythiaAnalysis with EVENTSTORE) without generating them again:
+# the stored events of every pTHat bin are split into NCHUNKS chunks that are analysed in parallel,
+# the outputs are merged and normalized per event in one pass
+#
+# ./replay_PythiaAnalysis.sh "events_*.root" NCHUNKS OUTPUT PROCESS NEVENTS CMENERGY [SHOWEROPT RENSCALE FACSCALE BOOSTZ PDF1 PDF2]
+# (same arguments as for the generation, NEVENTS is ignored; PTBINNING etc. are passed on)
+
+if [ "$#" -lt "6" ];
+then
+    echo "Usage: $0 \"events_*.root\" NCHUNKS OUTPUT PROCESS NEVENTS CMENERGY [further arguments of PythiaAnalysis]"
+    exit 1
+fi
+
+STORE=$1
+NCHUNKS=$2
+OUTPUT=$3
+shift 3
+
+for (( i=0; i<${NCHUNKS}; i++ )); do
+    REPLAY="${STORE}" REPLAY_CHUNK=${i}/${NCHUNKS} ./PythiaAnalysis replay_${i}_${OUTPUT} "$@" > replay_${i}_${OUTPUT}.log 2>&1 &
+done
+wait
+
+./normalize -o ${OUTPUT}.root replay_[0-9]*_${OUTPUT}.root
+
+exit $?
@@ -0,0 +1,88 @@
+#!/bin/bash
+
+# local stand-in for a SLURM array of submit_PythiaAnalysis.sh (workstations, CI): NTASKS tasks of PythiaAnalysis
+# on all cores, every idle core takes the next task of the queue, so long and short tasks balance themselves;
+# failed tasks are retried (continuing from their checkpoint), the outputs are merged and normalized at the end
+#
+# ./run_PythiaAnalysisLocal.sh NTASKS PROCESS NEVENTS CMENERGY [SHOWEROPT RENSCALE FACSCALE BOOSTZ PDF1 PDF2]
+#
+# optional environment variables: NCORES (default: all cores), RETRIES (default: 2), SEED (campaign seed,
+# default: time of the start), all others (PTBINNING, WEIGHTLOG, ...) are passed on to PythiaAnalysis
+
+if [ "$#" -lt "4" ];
+then
+    echo "Usage: $0 NTASKS PROCESS NEVENTS CMENERGY [SHOWEROPT RENSCALE FACSCALE BOOSTZ PDF1 PDF2]"
+    exit 1
+fi
+
+NTASKS=$1
+shift
+
+PROCESS=$1
+NEVENTS=$2
+CMENERGY=$3
+SHOWEROPT=$4
+RENSCALE=$5
+FACSCALE=$6
+BOOSTZ=$7
+PDF1=$8
+PDF2=$9
+
+NCORES=${NCORES:-$(nproc)}
+export RETRIES=${RETRIES:-2}
+export SEED=${SEED:-$(date +%s)}
+export CHECKPOINT=${CHECKPOINT:-600}
+
+DATE=$(date +%F)
+JOBID=local${SEED}
+
+# same directory layout as submit_PythiaAnalysis.sh
+#---------------------------------------------------------------------
+OUTDIR=./py8events_${CMENERGY}GeV/${DATE}_${PROCESS}_${NEVENTS}ev
+if [ $# -ge 4 ]; then OUTDIR+=_${SHOWEROPT}; fi
+if [ $# -ge 5 ]; then OUTDIR+=_${RENSCALE}; fi
+if [ $# -ge 6 ]; then OUTDIR+=_${FACSCALE}; fi
+if [ $# -ge 7 ]; then OUTDIR+=_betaZ${BOOSTZ}; fi
+if [ $# -ge 8 ]; then OUTDIR+=_${PDF1}; fi
+if [ $# -ge 9 ]; then OUTDIR+=_${PDF2}; fi
+OUTDIR+=_jobID${JOBID}
+
+mkdir -p ${OUTDIR}
+cp PythiaAnalysis src/PythiaAnalysis.cpp src/PythiaAnalysisHelper.cxx ${OUTDIR}
+OLDDIR=${PWD}
+cd ${OUTDIR}
+
+# one task with retries, the output of a task is <task>.root, its log <task>.log
+run_task(){
+    TASK=$1
+    shift
+    for (( ATTEMPT=1; ATTEMPT<=RETRIES+1; ATTEMPT++ )); do
+        if SLURM_ARRAY_TASK_ID=${TASK} ./PythiaAnalysis ${TASK} "$@" >> ${TASK}.log 2>&1; then
+            echo "task ${TASK} done"
+            return 0
+        fi
+        echo "task ${TASK} failed (attempt ${ATTEMPT})"
+    done
+    echo ${TASK} >> failed_tasks.txt
+    return 1
+}
+export -f run_task
+
+echo "running ${NTASKS} tasks on ${NCORES} cores in ${OUTDIR} (campaign seed ${SEED})"
+rm -f failed_tasks.txt
+time seq 0 $((NTASKS-1)) | xargs -P ${NCORES} -I{} bash -c 'run_task "$@"' _ {} "$@"
+
+# merge and normalize, as do_merge_normalize.sh of the array jobs
+ROOTFILENAME="merged_${PROCESS}.root"
+cat << EOF >do_merge_normalize.sh
+${OLDDIR}/normalize -o ${ROOTFILENAME} [0-9]*.root
+EOF
+bash do_merge_normalize.sh
+
+if [ -f failed_tasks.txt ]; then
+    echo "failed tasks (not merged): $(sort -n failed_tasks.txt | tr '\n' ' ')"
+    echo "rerun them with SEED=${SEED} for identical results"
+    exit 1
+fi
+
+exit $?
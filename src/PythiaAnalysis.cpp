@@ -10,6 +10,7 @@
 #include "TMath.h"
 #include "TCanvas.h"
 #include "TPaveText.h"
+#include <ctime>
 
 #include "fastjet/ClusterSequence.hh"
 
@@ -17,6 +18,11 @@
 int main(int, char **);
 int main(int argc, char **argv) {
 
+  // MPI mode (PythiaAnalysis_mpi, e.g. "mpirun -np 8 ./PythiaAnalysis_mpi abc JJ 1000 13000 fullEvents"):
+  // all ranks generate the same pTHat bins with their own seeds, rank 0 writes the summed histograms to abc.root
+  // (not normalized, as hadd of the rank outputs: "normalize abc.root" as for a single job)
+  pyHelp.Init_MPI(&argc, &argv);
+
   // not so much output at the beginning
   p.readString("Next:numberCount = 100000");
   p.readString("Next:numberShowLHA = 0");
@@ -28,7 +34,7 @@ int main(int argc, char **argv) {
 
   //--- read commandline args ----------------------------------------
   if (argc < 5) {
-    printf("Need at least first 4 arguments:\n%s [output root file] [\"MB\",\"MBVeto\",\"JJ\",\"GJ\",\"WeakBoson\"] [number of events per pthatbin] [cm energy in GeV] [\"fullEvents\",\"noMPI\",\"noHadro\",\"noMPInoHadro\",\"noShower\"] [renormScaleFac] [factorMultFac] [beta_boost_z] [pdfA] [pdfB]", argv[0]);
+    printf("Need at least first 4 arguments:\n%s [output root file] [\"MB\",\"MBVeto\",\"JJ\",\"GJ\",\"WeakBoson\"] [number of events per pthatbin] [cm energy in GeV] [\"fullEvents\",\"noMPI\",\"noHadro\",\"noMPInoHadro\",\"noShower\"] [renormScaleFac] [factorMultFac] [beta_boost_z] [pdfA] [pdfB]\n(optional environment variables: PTBINNING selects the pt binning of the spectra, CHECKPOINT = checkpoint interval in seconds, DEADLINE = seconds until a graceful end, EVENTSTORE = |eta| limit of the stored particles or \"all\", REPLAY = event store files to analyse instead of generating, REPLAY_CHUNK = i/n, WEIGHTLOG = 1 for a per-event weight log, EVENTSEEDS = 1 for per-event seeds, REGENERATE = list of events to regenerate, PROGRESS = progress report interval in seconds, SEED = campaign seed, FORKWORKERS = number of workers forked per pTHat bin, TIMING = 1 for the time per stage and pTHat bin, PERFCOUNTERS = 1 for hardware counters per stage)\n", argv[0]);
     exit(EXIT_FAILURE);
   }
 
@@ -45,6 +51,16 @@ int main(int argc, char **argv) {
   // argv[10]: external pdf beam B
 
   snprintf( rootFileName, sizeof(rootFileName), "%s.root", argv[1]);  // "abc" -> "abc.root"
+
+  // SEED = campaign seed: reproducible seeds from (SEED, task ID = argv[1], pTHat bin) instead of TRandom3(0),
+  // a failed array task rerun with the same SEED gives bit-identical results
+  // (MPI: task ID = rank)
+  if( getenv("SEED") && !pyHelp.Set_Campaign_Seed(pyHelp.Get_MPI_Size() > 1 ? Form("%d", pyHelp.Get_MPI_Rank()) : argv[1]) )
+    exit(EXIT_FAILURE);
+
+  // name of the side files (checkpoint_, events_, weightlog_), one set per rank in MPI mode
+  TString sideFileName = rootFileName;
+  if( pyHelp.Get_MPI_Size() > 1 ) sideFileName.Insert(sideFileName.Last('/')+1, Form("rank%d_", pyHelp.Get_MPI_Rank()));
   printf("\nThe result will be written into %s\n", rootFileName);
 
   // p.readString("TimeShower:pTminChgQ = 2.0");  // test shower cut-off
@@ -75,6 +91,12 @@ int main(int argc, char **argv) {
 
   pyHelp.Pass_Parameters_To_Pythia(p, argc, argv); // which energy, scales, optional master switches
 
+  // pt binning of the spectra, projected from the fine accumulators at write time
+  // PTBINNING = "default", "Marco", "omega", "eta", "mergedEMCal" or comma separated edges of ptBinArrayFine
+  if( getenv("PTBINNING") && !pyHelp.Set_PtBinning(getenv("PTBINNING")) )
+    exit(EXIT_FAILURE);
+  printf("\nUsing pt binning \"%s\" for the spectra\n", pyHelp.ptBinningName.c_str());
+
   int pTHatBins = 0;
   double pTHatBin[100];
   // pthat bin definition from ALICE JJ production at 8 TeV
@@ -152,123 +174,123 @@ int main(int argc, char **argv) {
   TH1D *h_isoPt_corrected = new TH1D("h_isoPt_corrected","sum of pt in iso cone minus UE", pyHelp.ptBins, pyHelp.ptBinArray);
     
   // all electrons (+ positrons)
-  TH1D *h_electron_yDefault = new TH1D("h_electron_yDefault","e^{#pm} in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_electron_etaLarge = new TH1D("h_electron_etaLarge","e^{#pm} in |#eta| < 3.00", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_electron_etaTPC   = new TH1D("h_electron_etaTPC"  ,"e^{#pm} in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_electron_etaEMCal = new TH1D("h_electron_etaEMCal","e^{#pm} in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_electron_etaPHOS  = new TH1D("h_electron_etaPHOS" ,"e^{#pm} in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_electron_yDefault = new TH1D("h_electron_yDefault","e^{#pm} in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_electron_etaLarge = new TH1D("h_electron_etaLarge","e^{#pm} in |#eta| < 3.00", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_electron_etaTPC   = new TH1D("h_electron_etaTPC"  ,"e^{#pm} in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_electron_etaEMCal = new TH1D("h_electron_etaEMCal","e^{#pm} in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_electron_etaPHOS  = new TH1D("h_electron_etaPHOS" ,"e^{#pm} in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // all pions without secondary correction
-  TH1D *h_pi0_yDefault = new TH1D("h_pi0_yDefault","#pi^{0} in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_pi0_etaLarge = new TH1D("h_pi0_etaLarge","#pi^{0} in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_pi0_etaTPC   = new TH1D("h_pi0_etaTPC"  ,"#pi^{0} in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_pi0_etaEMCal = new TH1D("h_pi0_etaEMCal","#pi^{0} in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_pi0_etaPHOS  = new TH1D("h_pi0_etaPHOS" ,"#pi^{0} in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_pi0_yDefault = new TH1D("h_pi0_yDefault","#pi^{0} in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_pi0_etaLarge = new TH1D("h_pi0_etaLarge","#pi^{0} in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_pi0_etaTPC   = new TH1D("h_pi0_etaTPC"  ,"#pi^{0} in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_pi0_etaEMCal = new TH1D("h_pi0_etaEMCal","#pi^{0} in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_pi0_etaPHOS  = new TH1D("h_pi0_etaPHOS" ,"#pi^{0} in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // primary pions (with secondary correction)
-  TH1D *h_pi0primary_yDefault = new TH1D("h_pi0primary_yDefault","#pi^{0} (primary) in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_pi0primary_etaLarge = new TH1D("h_pi0primary_etaLarge","#pi^{0} (primary) in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_pi0primary_etaTPC   = new TH1D("h_pi0primary_etaTPC"  ,"#pi^{0} (primary) in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_pi0primary_etaEMCal = new TH1D("h_pi0primary_etaEMCal","#pi^{0} (primary) in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_pi0primary_etaPHOS  = new TH1D("h_pi0primary_etaPHOS" ,"#pi^{0} (primary) in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_pi0primary_yDefault = new TH1D("h_pi0primary_yDefault","#pi^{0} (primary) in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_pi0primary_etaLarge = new TH1D("h_pi0primary_etaLarge","#pi^{0} (primary) in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_pi0primary_etaTPC   = new TH1D("h_pi0primary_etaTPC"  ,"#pi^{0} (primary) in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_pi0primary_etaEMCal = new TH1D("h_pi0primary_etaEMCal","#pi^{0} (primary) in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_pi0primary_etaPHOS  = new TH1D("h_pi0primary_etaPHOS" ,"#pi^{0} (primary) in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // eta meson
-  TH1D *h_eta_yDefault = new TH1D("h_eta_yDefault","#eta in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_eta_etaLarge = new TH1D("h_eta_etaLarge","#eta in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_eta_etaTPC   = new TH1D("h_eta_etaTPC"  ,"#eta in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_eta_etaEMCal = new TH1D("h_eta_etaEMCal","#eta in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_eta_etaPHOS  = new TH1D("h_eta_etaPHOS" ,"#eta in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_eta_yDefault = new TH1D("h_eta_yDefault","#eta in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_eta_etaLarge = new TH1D("h_eta_etaLarge","#eta in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_eta_etaTPC   = new TH1D("h_eta_etaTPC"  ,"#eta in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_eta_etaEMCal = new TH1D("h_eta_etaEMCal","#eta in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_eta_etaPHOS  = new TH1D("h_eta_etaPHOS" ,"#eta in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // eta prime meson
-  TH1D *h_etaprime_yDefault = new TH1D("h_etaprime_yDefault","#eta' in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_etaprime_etaLarge = new TH1D("h_etaprime_etaLarge","#eta' in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_etaprime_etaTPC   = new TH1D("h_etaprime_etaTPC"  ,"#eta' in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_etaprime_etaEMCal = new TH1D("h_etaprime_etaEMCal","#eta' in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_etaprime_etaPHOS  = new TH1D("h_etaprime_etaPHOS" ,"#eta' in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_etaprime_yDefault = new TH1D("h_etaprime_yDefault","#eta' in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_etaprime_etaLarge = new TH1D("h_etaprime_etaLarge","#eta' in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_etaprime_etaTPC   = new TH1D("h_etaprime_etaTPC"  ,"#eta' in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_etaprime_etaEMCal = new TH1D("h_etaprime_etaEMCal","#eta' in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_etaprime_etaPHOS  = new TH1D("h_etaprime_etaPHOS" ,"#eta' in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // omega meson
-  TH1D *h_omega_yDefault = new TH1D("h_omega_yDefault","#omega in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_omega_etaLarge = new TH1D("h_omega_etaLarge","#omega in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_omega_etaTPC   = new TH1D("h_omega_etaTPC"  ,"#omega in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_omega_etaEMCal = new TH1D("h_omega_etaEMCal","#omega in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_omega_etaPHOS  = new TH1D("h_omega_etaPHOS" ,"#omega in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_omega_yDefault = new TH1D("h_omega_yDefault","#omega in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_omega_etaLarge = new TH1D("h_omega_etaLarge","#omega in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_omega_etaTPC   = new TH1D("h_omega_etaTPC"  ,"#omega in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_omega_etaEMCal = new TH1D("h_omega_etaEMCal","#omega in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_omega_etaPHOS  = new TH1D("h_omega_etaPHOS" ,"#omega in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // direct photons (consider only direct photons)
-  TH1D *h_direct_photons_yDefault = new TH1D("h_direct_photons_yDefault","direct photons in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_direct_photons_etaLarge = new TH1D("h_direct_photons_etaLarge","direct photons in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_direct_photons_etaTPC   = new TH1D("h_direct_photons_etaTPC"  ,"direct photons in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_direct_photons_etaEMCal = new TH1D("h_direct_photons_etaEMCal","direct photons in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_direct_photons_etaPHOS  = new TH1D("h_direct_photons_etaPHOS" ,"direct photons in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_direct_photons_yDefault = new TH1D("h_direct_photons_yDefault","direct photons in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_direct_photons_etaLarge = new TH1D("h_direct_photons_etaLarge","direct photons in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_direct_photons_etaTPC   = new TH1D("h_direct_photons_etaTPC"  ,"direct photons in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_direct_photons_etaEMCal = new TH1D("h_direct_photons_etaEMCal","direct photons in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_direct_photons_etaPHOS  = new TH1D("h_direct_photons_etaPHOS" ,"direct photons in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
   
   // shower/fragmentation photons only (gammas from "q -> q gamma" splitting)
-  TH1D *h_shower_photons_yDefault = new TH1D("h_shower_photons_yDefault","shower photons (q -> q #gamma) in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_shower_photons_etaLarge = new TH1D("h_shower_photons_etaLarge","shower photons (q -> q #gamma) in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_shower_photons_etaTPC   = new TH1D("h_shower_photons_etaTPC"  ,"shower photons (q -> q #gamma) in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_shower_photons_etaEMCal = new TH1D("h_shower_photons_etaEMCal","shower photons (q -> q #gamma) in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_shower_photons_etaPHOS  = new TH1D("h_shower_photons_etaPHOS" ,"shower photons (q -> q #gamma) in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_shower_photons_yDefault = new TH1D("h_shower_photons_yDefault","shower photons (q -> q #gamma) in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_shower_photons_etaLarge = new TH1D("h_shower_photons_etaLarge","shower photons (q -> q #gamma) in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_shower_photons_etaTPC   = new TH1D("h_shower_photons_etaTPC"  ,"shower photons (q -> q #gamma) in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_shower_photons_etaEMCal = new TH1D("h_shower_photons_etaEMCal","shower photons (q -> q #gamma) in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_shower_photons_etaPHOS  = new TH1D("h_shower_photons_etaPHOS" ,"shower photons (q -> q #gamma) in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
   
   // photons from ME (aka prompt)
-  TH1D *h_222_photons_yDefault = new TH1D("h_222_photons_yDefault","photons from ME (aka prompt) in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_222_photons_etaLarge = new TH1D("h_222_photons_etaLarge","photons from ME (aka prompt) in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_222_photons_etaTPC   = new TH1D("h_222_photons_etaTPC"  ,"photons from ME (aka prompt) in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_222_photons_etaEMCal = new TH1D("h_222_photons_etaEMCal","photons from ME (aka prompt) in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_222_photons_etaPHOS  = new TH1D("h_222_photons_etaPHOS" ,"photons from ME (aka prompt) in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_222_photons_yDefault = new TH1D("h_222_photons_yDefault","photons from ME (aka prompt) in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_222_photons_etaLarge = new TH1D("h_222_photons_etaLarge","photons from ME (aka prompt) in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_222_photons_etaTPC   = new TH1D("h_222_photons_etaTPC"  ,"photons from ME (aka prompt) in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_222_photons_etaEMCal = new TH1D("h_222_photons_etaEMCal","photons from ME (aka prompt) in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_222_photons_etaPHOS  = new TH1D("h_222_photons_etaPHOS" ,"photons from ME (aka prompt) in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
   
   // decay photons
-  TH1D *h_decay_photons_yDefault = new TH1D("h_decay_photons_yDefault","decay photons in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_decay_photons_etaLarge = new TH1D("h_decay_photons_etaLarge","decay photons in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_decay_photons_etaTPC   = new TH1D("h_decay_photons_etaTPC"  ,"decay photons in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_decay_photons_etaEMCal = new TH1D("h_decay_photons_etaEMCal","decay photons in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_decay_photons_etaPHOS  = new TH1D("h_decay_photons_etaPHOS" ,"decay photons in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_decay_photons_yDefault = new TH1D("h_decay_photons_yDefault","decay photons in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_decay_photons_etaLarge = new TH1D("h_decay_photons_etaLarge","decay photons in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_decay_photons_etaTPC   = new TH1D("h_decay_photons_etaTPC"  ,"decay photons in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_decay_photons_etaEMCal = new TH1D("h_decay_photons_etaEMCal","decay photons in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_decay_photons_etaPHOS  = new TH1D("h_decay_photons_etaPHOS" ,"decay photons in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // isolated photons (considers only direct photons)
-  TH1D *h_iso_charged2GeV_R03_photons_etaTPC   = new TH1D("h_iso_charged2GeV_R03_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged2GeV_R03_photons_etaEMCal = new TH1D("h_iso_charged2GeV_R03_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged2GeV_R03_photons_etaPHOS  = new TH1D("h_iso_charged2GeV_R03_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_charged2GeV_R03_photons_etaTPC   = new TH1D("h_iso_charged2GeV_R03_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged2GeV_R03_photons_etaEMCal = new TH1D("h_iso_charged2GeV_R03_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged2GeV_R03_photons_etaPHOS  = new TH1D("h_iso_charged2GeV_R03_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_charged2GeV_R04_photons_etaTPC   = new TH1D("h_iso_charged2GeV_R04_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged2GeV_R04_photons_etaEMCal = new TH1D("h_iso_charged2GeV_R04_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged2GeV_R04_photons_etaPHOS  = new TH1D("h_iso_charged2GeV_R04_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_charged2GeV_R04_photons_etaTPC   = new TH1D("h_iso_charged2GeV_R04_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged2GeV_R04_photons_etaEMCal = new TH1D("h_iso_charged2GeV_R04_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged2GeV_R04_photons_etaPHOS  = new TH1D("h_iso_charged2GeV_R04_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_charged2GeV_R05_photons_etaTPC   = new TH1D("h_iso_charged2GeV_R05_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged2GeV_R05_photons_etaEMCal = new TH1D("h_iso_charged2GeV_R05_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged2GeV_R05_photons_etaPHOS  = new TH1D("h_iso_charged2GeV_R05_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_charged2GeV_R05_photons_etaTPC   = new TH1D("h_iso_charged2GeV_R05_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged2GeV_R05_photons_etaEMCal = new TH1D("h_iso_charged2GeV_R05_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged2GeV_R05_photons_etaPHOS  = new TH1D("h_iso_charged2GeV_R05_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_charged3GeV_R03_photons_etaTPC   = new TH1D("h_iso_charged3GeV_R03_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged3GeV_R03_photons_etaEMCal = new TH1D("h_iso_charged3GeV_R03_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged3GeV_R03_photons_etaPHOS  = new TH1D("h_iso_charged3GeV_R03_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_charged3GeV_R03_photons_etaTPC   = new TH1D("h_iso_charged3GeV_R03_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged3GeV_R03_photons_etaEMCal = new TH1D("h_iso_charged3GeV_R03_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged3GeV_R03_photons_etaPHOS  = new TH1D("h_iso_charged3GeV_R03_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_charged3GeV_R04_photons_etaTPC   = new TH1D("h_iso_charged3GeV_R04_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged3GeV_R04_photons_etaEMCal = new TH1D("h_iso_charged3GeV_R04_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged3GeV_R04_photons_etaPHOS  = new TH1D("h_iso_charged3GeV_R04_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_charged3GeV_R04_photons_etaTPC   = new TH1D("h_iso_charged3GeV_R04_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged3GeV_R04_photons_etaEMCal = new TH1D("h_iso_charged3GeV_R04_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged3GeV_R04_photons_etaPHOS  = new TH1D("h_iso_charged3GeV_R04_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_charged3GeV_R05_photons_etaTPC   = new TH1D("h_iso_charged3GeV_R05_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged3GeV_R05_photons_etaEMCal = new TH1D("h_iso_charged3GeV_R05_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_charged3GeV_R05_photons_etaPHOS  = new TH1D("h_iso_charged3GeV_R05_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_charged3GeV_R05_photons_etaTPC   = new TH1D("h_iso_charged3GeV_R05_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged3GeV_R05_photons_etaEMCal = new TH1D("h_iso_charged3GeV_R05_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_charged3GeV_R05_photons_etaPHOS  = new TH1D("h_iso_charged3GeV_R05_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_full2GeV_R03_photons_etaTPC      = new TH1D("h_iso_full2GeV_R03_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full2GeV_R03_photons_etaEMCal    = new TH1D("h_iso_full2GeV_R03_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full2GeV_R03_photons_etaPHOS     = new TH1D("h_iso_full2GeV_R03_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_full2GeV_R03_photons_etaTPC      = new TH1D("h_iso_full2GeV_R03_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full2GeV_R03_photons_etaEMCal    = new TH1D("h_iso_full2GeV_R03_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full2GeV_R03_photons_etaPHOS     = new TH1D("h_iso_full2GeV_R03_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_full2GeV_R04_photons_etaTPC      = new TH1D("h_iso_full2GeV_R04_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full2GeV_R04_photons_etaEMCal    = new TH1D("h_iso_full2GeV_R04_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full2GeV_R04_photons_etaPHOS     = new TH1D("h_iso_full2GeV_R04_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_full2GeV_R04_photons_etaTPC      = new TH1D("h_iso_full2GeV_R04_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full2GeV_R04_photons_etaEMCal    = new TH1D("h_iso_full2GeV_R04_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full2GeV_R04_photons_etaPHOS     = new TH1D("h_iso_full2GeV_R04_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_full2GeV_R05_photons_etaTPC      = new TH1D("h_iso_full2GeV_R05_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full2GeV_R05_photons_etaEMCal    = new TH1D("h_iso_full2GeV_R05_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full2GeV_R05_photons_etaPHOS     = new TH1D("h_iso_full2GeV_R05_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_full2GeV_R05_photons_etaTPC      = new TH1D("h_iso_full2GeV_R05_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full2GeV_R05_photons_etaEMCal    = new TH1D("h_iso_full2GeV_R05_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full2GeV_R05_photons_etaPHOS     = new TH1D("h_iso_full2GeV_R05_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_full3GeV_R03_photons_etaTPC      = new TH1D("h_iso_full3GeV_R03_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full3GeV_R03_photons_etaEMCal    = new TH1D("h_iso_full3GeV_R03_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full3GeV_R03_photons_etaPHOS     = new TH1D("h_iso_full3GeV_R03_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_full3GeV_R03_photons_etaTPC      = new TH1D("h_iso_full3GeV_R03_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full3GeV_R03_photons_etaEMCal    = new TH1D("h_iso_full3GeV_R03_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full3GeV_R03_photons_etaPHOS     = new TH1D("h_iso_full3GeV_R03_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_full3GeV_R04_photons_etaTPC      = new TH1D("h_iso_full3GeV_R04_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full3GeV_R04_photons_etaEMCal    = new TH1D("h_iso_full3GeV_R04_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full3GeV_R04_photons_etaPHOS     = new TH1D("h_iso_full3GeV_R04_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_full3GeV_R04_photons_etaTPC      = new TH1D("h_iso_full3GeV_R04_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full3GeV_R04_photons_etaEMCal    = new TH1D("h_iso_full3GeV_R04_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full3GeV_R04_photons_etaPHOS     = new TH1D("h_iso_full3GeV_R04_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_iso_full3GeV_R05_photons_etaTPC      = new TH1D("h_iso_full3GeV_R05_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full3GeV_R05_photons_etaEMCal    = new TH1D("h_iso_full3GeV_R05_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_iso_full3GeV_R05_photons_etaPHOS     = new TH1D("h_iso_full3GeV_R05_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_iso_full3GeV_R05_photons_etaTPC      = new TH1D("h_iso_full3GeV_R05_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full3GeV_R05_photons_etaEMCal    = new TH1D("h_iso_full3GeV_R05_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_iso_full3GeV_R05_photons_etaPHOS     = new TH1D("h_iso_full3GeV_R05_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // isolation sum of differen photons
   TH1D *h_iso_charged_R03_decay_photons_etaTPC = new TH1D("h_iso_charged_R03_decay_photons_etaTPC", "decay photon iso (charged pt in R=0.3) decay_photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
@@ -348,121 +370,193 @@ int main(int argc, char **argv) {
   // do the same jazz for invariant cross section histos ------------------------------------------
   //------------------------------------------------------------------------------------------
   // all pions without secondary correction
-  TH1D *h_invXsec_pi0_yDefault = new TH1D("h_invXsec_pi0_yDefault","#pi^{0} in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_pi0_etaLarge = new TH1D("h_invXsec_pi0_etaLarge","#pi^{0} in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_pi0_etaTPC   = new TH1D("h_invXsec_pi0_etaTPC"  ,"#pi^{0} in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_pi0_etaEMCal = new TH1D("h_invXsec_pi0_etaEMCal","#pi^{0} in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_pi0_etaPHOS  = new TH1D("h_invXsec_pi0_etaPHOS" ,"#pi^{0} in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_pi0_yDefault = new TH1D("h_invXsec_pi0_yDefault","#pi^{0} in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_pi0_etaLarge = new TH1D("h_invXsec_pi0_etaLarge","#pi^{0} in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_pi0_etaTPC   = new TH1D("h_invXsec_pi0_etaTPC"  ,"#pi^{0} in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_pi0_etaEMCal = new TH1D("h_invXsec_pi0_etaEMCal","#pi^{0} in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_pi0_etaPHOS  = new TH1D("h_invXsec_pi0_etaPHOS" ,"#pi^{0} in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // primary pions (with secondary correction)
-  TH1D *h_invXsec_pi0primary_yDefault = new TH1D("h_invXsec_pi0primary_yDefault","#pi^{0} (primary) in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_pi0primary_etaLarge = new TH1D("h_invXsec_pi0primary_etaLarge","#pi^{0} (primary) in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_pi0primary_etaTPC   = new TH1D("h_invXsec_pi0primary_etaTPC"  ,"#pi^{0} (primary) in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_pi0primary_etaEMCal = new TH1D("h_invXsec_pi0primary_etaEMCal","#pi^{0} (primary) in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_pi0primary_etaPHOS  = new TH1D("h_invXsec_pi0primary_etaPHOS" ,"#pi^{0} (primary) in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_pi0primary_yDefault = new TH1D("h_invXsec_pi0primary_yDefault","#pi^{0} (primary) in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_pi0primary_etaLarge = new TH1D("h_invXsec_pi0primary_etaLarge","#pi^{0} (primary) in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_pi0primary_etaTPC   = new TH1D("h_invXsec_pi0primary_etaTPC"  ,"#pi^{0} (primary) in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_pi0primary_etaEMCal = new TH1D("h_invXsec_pi0primary_etaEMCal","#pi^{0} (primary) in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_pi0primary_etaPHOS  = new TH1D("h_invXsec_pi0primary_etaPHOS" ,"#pi^{0} (primary) in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // eta meson
-  TH1D *h_invXsec_eta_yDefault = new TH1D("h_invXsec_eta_yDefault","#eta in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_eta_etaLarge = new TH1D("h_invXsec_eta_etaLarge","#eta in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_eta_etaTPC   = new TH1D("h_invXsec_eta_etaTPC"  ,"#eta in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_eta_etaEMCal = new TH1D("h_invXsec_eta_etaEMCal","#eta in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_eta_etaPHOS  = new TH1D("h_invXsec_eta_etaPHOS" ,"#eta in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_eta_yDefault = new TH1D("h_invXsec_eta_yDefault","#eta in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_eta_etaLarge = new TH1D("h_invXsec_eta_etaLarge","#eta in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_eta_etaTPC   = new TH1D("h_invXsec_eta_etaTPC"  ,"#eta in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_eta_etaEMCal = new TH1D("h_invXsec_eta_etaEMCal","#eta in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_eta_etaPHOS  = new TH1D("h_invXsec_eta_etaPHOS" ,"#eta in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // eta prime meson
-  TH1D *h_invXsec_etaprime_yDefault = new TH1D("h_invXsec_etaprime_yDefault","#eta' in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_etaprime_etaLarge = new TH1D("h_invXsec_etaprime_etaLarge","#eta' in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_etaprime_etaTPC   = new TH1D("h_invXsec_etaprime_etaTPC"  ,"#eta' in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_etaprime_etaEMCal = new TH1D("h_invXsec_etaprime_etaEMCal","#eta' in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_etaprime_etaPHOS  = new TH1D("h_invXsec_etaprime_etaPHOS" ,"#eta' in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_etaprime_yDefault = new TH1D("h_invXsec_etaprime_yDefault","#eta' in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_etaprime_etaLarge = new TH1D("h_invXsec_etaprime_etaLarge","#eta' in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_etaprime_etaTPC   = new TH1D("h_invXsec_etaprime_etaTPC"  ,"#eta' in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_etaprime_etaEMCal = new TH1D("h_invXsec_etaprime_etaEMCal","#eta' in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_etaprime_etaPHOS  = new TH1D("h_invXsec_etaprime_etaPHOS" ,"#eta' in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // omega meson
-  TH1D *h_invXsec_omega_yDefault = new TH1D("h_invXsec_omega_yDefault","#omega in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_omega_etaLarge = new TH1D("h_invXsec_omega_etaLarge","#omega in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_omega_etaTPC   = new TH1D("h_invXsec_omega_etaTPC"  ,"#omega in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_omega_etaEMCal = new TH1D("h_invXsec_omega_etaEMCal","#omega in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_omega_etaPHOS  = new TH1D("h_invXsec_omega_etaPHOS" ,"#omega in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_omega_yDefault = new TH1D("h_invXsec_omega_yDefault","#omega in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_omega_etaLarge = new TH1D("h_invXsec_omega_etaLarge","#omega in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_omega_etaTPC   = new TH1D("h_invXsec_omega_etaTPC"  ,"#omega in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_omega_etaEMCal = new TH1D("h_invXsec_omega_etaEMCal","#omega in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_omega_etaPHOS  = new TH1D("h_invXsec_omega_etaPHOS" ,"#omega in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // direct photons (consider only direct photons)
-  TH1D *h_invXsec_direct_photons_yDefault = new TH1D("h_invXsec_direct_photons_yDefault","direct photons in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_direct_photons_etaLarge = new TH1D("h_invXsec_direct_photons_etaLarge","direct photons in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_direct_photons_etaTPC   = new TH1D("h_invXsec_direct_photons_etaTPC"  ,"direct photons in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_direct_photons_etaEMCal = new TH1D("h_invXsec_direct_photons_etaEMCal","direct photons in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_direct_photons_etaPHOS  = new TH1D("h_invXsec_direct_photons_etaPHOS" ,"direct photons in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_direct_photons_yDefault = new TH1D("h_invXsec_direct_photons_yDefault","direct photons in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_direct_photons_etaLarge = new TH1D("h_invXsec_direct_photons_etaLarge","direct photons in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_direct_photons_etaTPC   = new TH1D("h_invXsec_direct_photons_etaTPC"  ,"direct photons in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_direct_photons_etaEMCal = new TH1D("h_invXsec_direct_photons_etaEMCal","direct photons in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_direct_photons_etaPHOS  = new TH1D("h_invXsec_direct_photons_etaPHOS" ,"direct photons in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // shower/fragmentation photons only (gammas from "q -> q gamma" splitting)
-  TH1D *h_invXsec_shower_photons_yDefault = new TH1D("h_invXsec_shower_photons_yDefault","shower photons (q -> q #gamma) in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_shower_photons_etaLarge = new TH1D("h_invXsec_shower_photons_etaLarge","shower photons (q -> q #gamma) in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_shower_photons_etaTPC   = new TH1D("h_invXsec_shower_photons_etaTPC"  ,"shower photons (q -> q #gamma) in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_shower_photons_etaEMCal = new TH1D("h_invXsec_shower_photons_etaEMCal","shower photons (q -> q #gamma) in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_shower_photons_etaPHOS  = new TH1D("h_invXsec_shower_photons_etaPHOS" ,"shower photons (q -> q #gamma) in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_shower_photons_yDefault = new TH1D("h_invXsec_shower_photons_yDefault","shower photons (q -> q #gamma) in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_shower_photons_etaLarge = new TH1D("h_invXsec_shower_photons_etaLarge","shower photons (q -> q #gamma) in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_shower_photons_etaTPC   = new TH1D("h_invXsec_shower_photons_etaTPC"  ,"shower photons (q -> q #gamma) in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_shower_photons_etaEMCal = new TH1D("h_invXsec_shower_photons_etaEMCal","shower photons (q -> q #gamma) in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_shower_photons_etaPHOS  = new TH1D("h_invXsec_shower_photons_etaPHOS" ,"shower photons (q -> q #gamma) in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // photons from ME (aka prompt)
-  TH1D *h_invXsec_222_photons_yDefault = new TH1D("h_invXsec_222_photons_yDefault","photons from ME (aka prompt) in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_222_photons_etaLarge = new TH1D("h_invXsec_222_photons_etaLarge","photons from ME (aka prompt) in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_222_photons_etaTPC   = new TH1D("h_invXsec_222_photons_etaTPC"  ,"photons from ME (aka prompt) in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_222_photons_etaEMCal = new TH1D("h_invXsec_222_photons_etaEMCal","photons from ME (aka prompt) in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_222_photons_etaPHOS  = new TH1D("h_invXsec_222_photons_etaPHOS" ,"photons from ME (aka prompt) in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_222_photons_yDefault = new TH1D("h_invXsec_222_photons_yDefault","photons from ME (aka prompt) in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_222_photons_etaLarge = new TH1D("h_invXsec_222_photons_etaLarge","photons from ME (aka prompt) in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_222_photons_etaTPC   = new TH1D("h_invXsec_222_photons_etaTPC"  ,"photons from ME (aka prompt) in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_222_photons_etaEMCal = new TH1D("h_invXsec_222_photons_etaEMCal","photons from ME (aka prompt) in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_222_photons_etaPHOS  = new TH1D("h_invXsec_222_photons_etaPHOS" ,"photons from ME (aka prompt) in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // decay photons
-  TH1D *h_invXsec_decay_photons_yDefault = new TH1D("h_invXsec_decay_photons_yDefault","decay photons in |y| < 0.8", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_decay_photons_etaLarge = new TH1D("h_invXsec_decay_photons_etaLarge","decay photons in |#eta| < 3.0", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_decay_photons_etaTPC   = new TH1D("h_invXsec_decay_photons_etaTPC"  ,"decay photons in |#eta| < 0.9", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_decay_photons_etaEMCal = new TH1D("h_invXsec_decay_photons_etaEMCal","decay photons in |#eta| < 0.66", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_decay_photons_etaPHOS  = new TH1D("h_invXsec_decay_photons_etaPHOS" ,"decay photons in |#eta| < 0.12", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_decay_photons_yDefault = new TH1D("h_invXsec_decay_photons_yDefault","decay photons in |y| < 0.8", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_decay_photons_etaLarge = new TH1D("h_invXsec_decay_photons_etaLarge","decay photons in |#eta| < 3.0", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_decay_photons_etaTPC   = new TH1D("h_invXsec_decay_photons_etaTPC"  ,"decay photons in |#eta| < 0.9", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_decay_photons_etaEMCal = new TH1D("h_invXsec_decay_photons_etaEMCal","decay photons in |#eta| < 0.66", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_decay_photons_etaPHOS  = new TH1D("h_invXsec_decay_photons_etaPHOS" ,"decay photons in |#eta| < 0.12", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
   // isolated photons (considers only direct photons)
-  TH1D *h_invXsec_iso_charged2GeV_R03_photons_etaTPC   = new TH1D("h_invXsec_iso_charged2GeV_R03_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged2GeV_R03_photons_etaEMCal = new TH1D("h_invXsec_iso_charged2GeV_R03_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged2GeV_R03_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged2GeV_R03_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_charged2GeV_R03_photons_etaTPC   = new TH1D("h_invXsec_iso_charged2GeV_R03_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged2GeV_R03_photons_etaEMCal = new TH1D("h_invXsec_iso_charged2GeV_R03_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged2GeV_R03_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged2GeV_R03_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_charged2GeV_R04_photons_etaTPC   = new TH1D("h_invXsec_iso_charged2GeV_R04_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged2GeV_R04_photons_etaEMCal = new TH1D("h_invXsec_iso_charged2GeV_R04_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged2GeV_R04_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged2GeV_R04_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_charged2GeV_R04_photons_etaTPC   = new TH1D("h_invXsec_iso_charged2GeV_R04_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged2GeV_R04_photons_etaEMCal = new TH1D("h_invXsec_iso_charged2GeV_R04_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged2GeV_R04_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged2GeV_R04_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_charged2GeV_R05_photons_etaTPC   = new TH1D("h_invXsec_iso_charged2GeV_R05_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged2GeV_R05_photons_etaEMCal = new TH1D("h_invXsec_iso_charged2GeV_R05_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged2GeV_R05_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged2GeV_R05_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_charged2GeV_R05_photons_etaTPC   = new TH1D("h_invXsec_iso_charged2GeV_R05_photons_etaTPC","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged2GeV_R05_photons_etaEMCal = new TH1D("h_invXsec_iso_charged2GeV_R05_photons_etaEMCal","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged2GeV_R05_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged2GeV_R05_photons_etaPHOS","direct iso (charged pt 2 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_charged3GeV_R03_photons_etaTPC   = new TH1D("h_invXsec_iso_charged3GeV_R03_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged3GeV_R03_photons_etaEMCal = new TH1D("h_invXsec_iso_charged3GeV_R03_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged3GeV_R03_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged3GeV_R03_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_charged3GeV_R03_photons_etaTPC   = new TH1D("h_invXsec_iso_charged3GeV_R03_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged3GeV_R03_photons_etaEMCal = new TH1D("h_invXsec_iso_charged3GeV_R03_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged3GeV_R03_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged3GeV_R03_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_charged3GeV_R04_photons_etaTPC   = new TH1D("h_invXsec_iso_charged3GeV_R04_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged3GeV_R04_photons_etaEMCal = new TH1D("h_invXsec_iso_charged3GeV_R04_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged3GeV_R04_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged3GeV_R04_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_charged3GeV_R04_photons_etaTPC   = new TH1D("h_invXsec_iso_charged3GeV_R04_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged3GeV_R04_photons_etaEMCal = new TH1D("h_invXsec_iso_charged3GeV_R04_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged3GeV_R04_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged3GeV_R04_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_charged3GeV_R05_photons_etaTPC   = new TH1D("h_invXsec_iso_charged3GeV_R05_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged3GeV_R05_photons_etaEMCal = new TH1D("h_invXsec_iso_charged3GeV_R05_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_charged3GeV_R05_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged3GeV_R05_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_charged3GeV_R05_photons_etaTPC   = new TH1D("h_invXsec_iso_charged3GeV_R05_photons_etaTPC","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged3GeV_R05_photons_etaEMCal = new TH1D("h_invXsec_iso_charged3GeV_R05_photons_etaEMCal","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_charged3GeV_R05_photons_etaPHOS  = new TH1D("h_invXsec_iso_charged3GeV_R05_photons_etaPHOS","direct iso (charged pt 3 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_full2GeV_R03_photons_etaTPC      = new TH1D("h_invXsec_iso_full2GeV_R03_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full2GeV_R03_photons_etaEMCal    = new TH1D("h_invXsec_iso_full2GeV_R03_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full2GeV_R03_photons_etaPHOS     = new TH1D("h_invXsec_iso_full2GeV_R03_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_full2GeV_R03_photons_etaTPC      = new TH1D("h_invXsec_iso_full2GeV_R03_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full2GeV_R03_photons_etaEMCal    = new TH1D("h_invXsec_iso_full2GeV_R03_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full2GeV_R03_photons_etaPHOS     = new TH1D("h_invXsec_iso_full2GeV_R03_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_full2GeV_R04_photons_etaTPC      = new TH1D("h_invXsec_iso_full2GeV_R04_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full2GeV_R04_photons_etaEMCal    = new TH1D("h_invXsec_iso_full2GeV_R04_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full2GeV_R04_photons_etaPHOS     = new TH1D("h_invXsec_iso_full2GeV_R04_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_full2GeV_R04_photons_etaTPC      = new TH1D("h_invXsec_iso_full2GeV_R04_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full2GeV_R04_photons_etaEMCal    = new TH1D("h_invXsec_iso_full2GeV_R04_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full2GeV_R04_photons_etaPHOS     = new TH1D("h_invXsec_iso_full2GeV_R04_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_full2GeV_R05_photons_etaTPC      = new TH1D("h_invXsec_iso_full2GeV_R05_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full2GeV_R05_photons_etaEMCal    = new TH1D("h_invXsec_iso_full2GeV_R05_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full2GeV_R05_photons_etaPHOS     = new TH1D("h_invXsec_iso_full2GeV_R05_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_full2GeV_R05_photons_etaTPC      = new TH1D("h_invXsec_iso_full2GeV_R05_photons_etaTPC","direct iso (full pt 2 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full2GeV_R05_photons_etaEMCal    = new TH1D("h_invXsec_iso_full2GeV_R05_photons_etaEMCal","direct iso (full pt 2 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full2GeV_R05_photons_etaPHOS     = new TH1D("h_invXsec_iso_full2GeV_R05_photons_etaPHOS","direct iso (full pt 2 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_full3GeV_R03_photons_etaTPC      = new TH1D("h_invXsec_iso_full3GeV_R03_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full3GeV_R03_photons_etaEMCal    = new TH1D("h_invXsec_iso_full3GeV_R03_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full3GeV_R03_photons_etaPHOS     = new TH1D("h_invXsec_iso_full3GeV_R03_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_full3GeV_R03_photons_etaTPC      = new TH1D("h_invXsec_iso_full3GeV_R03_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.3) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full3GeV_R03_photons_etaEMCal    = new TH1D("h_invXsec_iso_full3GeV_R03_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.3) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full3GeV_R03_photons_etaPHOS     = new TH1D("h_invXsec_iso_full3GeV_R03_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.3) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_full3GeV_R04_photons_etaTPC      = new TH1D("h_invXsec_iso_full3GeV_R04_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full3GeV_R04_photons_etaEMCal    = new TH1D("h_invXsec_iso_full3GeV_R04_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full3GeV_R04_photons_etaPHOS     = new TH1D("h_invXsec_iso_full3GeV_R04_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_full3GeV_R04_photons_etaTPC      = new TH1D("h_invXsec_iso_full3GeV_R04_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.4) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full3GeV_R04_photons_etaEMCal    = new TH1D("h_invXsec_iso_full3GeV_R04_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.4) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full3GeV_R04_photons_etaPHOS     = new TH1D("h_invXsec_iso_full3GeV_R04_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.4) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
-  TH1D *h_invXsec_iso_full3GeV_R05_photons_etaTPC      = new TH1D("h_invXsec_iso_full3GeV_R05_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full3GeV_R05_photons_etaEMCal    = new TH1D("h_invXsec_iso_full3GeV_R05_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBins, pyHelp.ptBinArray);
-  TH1D *h_invXsec_iso_full3GeV_R05_photons_etaPHOS     = new TH1D("h_invXsec_iso_full3GeV_R05_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBins, pyHelp.ptBinArray);
+  TH1D *h_invXsec_iso_full3GeV_R05_photons_etaTPC      = new TH1D("h_invXsec_iso_full3GeV_R05_photons_etaTPC","direct iso (full pt 3 GeV/c in R=0.5) photons_etaTPC", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full3GeV_R05_photons_etaEMCal    = new TH1D("h_invXsec_iso_full3GeV_R05_photons_etaEMCal","direct iso (full pt 3 GeV/c in R=0.5) photons_etaEMCal", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
+  TH1D *h_invXsec_iso_full3GeV_R05_photons_etaPHOS     = new TH1D("h_invXsec_iso_full3GeV_R05_photons_etaPHOS","direct iso (full pt 3 GeV/c in R=0.5) photons_etaPHOS", pyHelp.ptBinsOut, pyHelp.ptBinArrayOut);
 
 
 
+  //----------------------------------------------------------------------------------------------------
+  // |eta| (|y|) x pt accumulators: all acceptances above are projections of these (pyHelp.etaBinArray/yBinArray contain their edges)
+  //----------------------------------------------------------------------------------------------------
+  TH2D *h2_electron_yPt = new TH2D("h2_electron_yPt","e^{#pm}: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_electron_etaPt = new TH2D("h2_electron_etaPt","e^{#pm}: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_pi0_yPt = new TH2D("h2_pi0_yPt","#pi^{0}: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_pi0_etaPt = new TH2D("h2_pi0_etaPt","#pi^{0}: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_pi0primary_yPt = new TH2D("h2_pi0primary_yPt","#pi^{0} (primary): |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_pi0primary_etaPt = new TH2D("h2_pi0primary_etaPt","#pi^{0} (primary): |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_eta_yPt = new TH2D("h2_eta_yPt","#eta: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_eta_etaPt = new TH2D("h2_eta_etaPt","#eta: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_etaprime_yPt = new TH2D("h2_etaprime_yPt","#eta': |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_etaprime_etaPt = new TH2D("h2_etaprime_etaPt","#eta': |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_omega_yPt = new TH2D("h2_omega_yPt","#omega: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_omega_etaPt = new TH2D("h2_omega_etaPt","#omega: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_direct_photons_yPt = new TH2D("h2_direct_photons_yPt","direct photons: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_direct_photons_etaPt = new TH2D("h2_direct_photons_etaPt","direct photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_shower_photons_yPt = new TH2D("h2_shower_photons_yPt","shower photons (q -> q #gamma): |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_shower_photons_etaPt = new TH2D("h2_shower_photons_etaPt","shower photons (q -> q #gamma): |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_222_photons_yPt = new TH2D("h2_222_photons_yPt","photons from ME (aka prompt): |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_222_photons_etaPt = new TH2D("h2_222_photons_etaPt","photons from ME (aka prompt): |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_decay_photons_yPt = new TH2D("h2_decay_photons_yPt","decay photons: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_decay_photons_etaPt = new TH2D("h2_decay_photons_etaPt","decay photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+
+  TH2D *h2_iso_charged2GeV_R03_photons_etaPt = new TH2D("h2_iso_charged2GeV_R03_photons_etaPt","direct iso (charged pt 2 GeV/c in R=0.3) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_charged2GeV_R04_photons_etaPt = new TH2D("h2_iso_charged2GeV_R04_photons_etaPt","direct iso (charged pt 2 GeV/c in R=0.4) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_charged2GeV_R05_photons_etaPt = new TH2D("h2_iso_charged2GeV_R05_photons_etaPt","direct iso (charged pt 2 GeV/c in R=0.5) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_charged3GeV_R03_photons_etaPt = new TH2D("h2_iso_charged3GeV_R03_photons_etaPt","direct iso (charged pt 3 GeV/c in R=0.3) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_charged3GeV_R04_photons_etaPt = new TH2D("h2_iso_charged3GeV_R04_photons_etaPt","direct iso (charged pt 3 GeV/c in R=0.4) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_charged3GeV_R05_photons_etaPt = new TH2D("h2_iso_charged3GeV_R05_photons_etaPt","direct iso (charged pt 3 GeV/c in R=0.5) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_full2GeV_R03_photons_etaPt = new TH2D("h2_iso_full2GeV_R03_photons_etaPt","direct iso (full pt 2 GeV/c in R=0.3) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_full2GeV_R04_photons_etaPt = new TH2D("h2_iso_full2GeV_R04_photons_etaPt","direct iso (full pt 2 GeV/c in R=0.4) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_full2GeV_R05_photons_etaPt = new TH2D("h2_iso_full2GeV_R05_photons_etaPt","direct iso (full pt 2 GeV/c in R=0.5) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_full3GeV_R03_photons_etaPt = new TH2D("h2_iso_full3GeV_R03_photons_etaPt","direct iso (full pt 3 GeV/c in R=0.3) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_full3GeV_R04_photons_etaPt = new TH2D("h2_iso_full3GeV_R04_photons_etaPt","direct iso (full pt 3 GeV/c in R=0.4) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_iso_full3GeV_R05_photons_etaPt = new TH2D("h2_iso_full3GeV_R05_photons_etaPt","direct iso (full pt 3 GeV/c in R=0.5) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+
+  // invariant cross section versions (derived from the 1/pT moments of the accumulators above)
+  TH2D *h2_invXsec_pi0_yPt = new TH2D("h2_invXsec_pi0_yPt","#pi^{0}: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_pi0_etaPt = new TH2D("h2_invXsec_pi0_etaPt","#pi^{0}: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_pi0primary_yPt = new TH2D("h2_invXsec_pi0primary_yPt","#pi^{0} (primary): |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_pi0primary_etaPt = new TH2D("h2_invXsec_pi0primary_etaPt","#pi^{0} (primary): |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_eta_yPt = new TH2D("h2_invXsec_eta_yPt","#eta: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_eta_etaPt = new TH2D("h2_invXsec_eta_etaPt","#eta: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_etaprime_yPt = new TH2D("h2_invXsec_etaprime_yPt","#eta': |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_etaprime_etaPt = new TH2D("h2_invXsec_etaprime_etaPt","#eta': |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_omega_yPt = new TH2D("h2_invXsec_omega_yPt","#omega: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_omega_etaPt = new TH2D("h2_invXsec_omega_etaPt","#omega: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_direct_photons_yPt = new TH2D("h2_invXsec_direct_photons_yPt","direct photons: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_direct_photons_etaPt = new TH2D("h2_invXsec_direct_photons_etaPt","direct photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_shower_photons_yPt = new TH2D("h2_invXsec_shower_photons_yPt","shower photons (q -> q #gamma): |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_shower_photons_etaPt = new TH2D("h2_invXsec_shower_photons_etaPt","shower photons (q -> q #gamma): |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_222_photons_yPt = new TH2D("h2_invXsec_222_photons_yPt","photons from ME (aka prompt): |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_222_photons_etaPt = new TH2D("h2_invXsec_222_photons_etaPt","photons from ME (aka prompt): |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_decay_photons_yPt = new TH2D("h2_invXsec_decay_photons_yPt","decay photons: |y| vs. p_{T}", pyHelp.yBins, pyHelp.yBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_decay_photons_etaPt = new TH2D("h2_invXsec_decay_photons_etaPt","decay photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+
+  TH2D *h2_invXsec_iso_charged2GeV_R03_photons_etaPt = new TH2D("h2_invXsec_iso_charged2GeV_R03_photons_etaPt","direct iso (charged pt 2 GeV/c in R=0.3) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_charged2GeV_R04_photons_etaPt = new TH2D("h2_invXsec_iso_charged2GeV_R04_photons_etaPt","direct iso (charged pt 2 GeV/c in R=0.4) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_charged2GeV_R05_photons_etaPt = new TH2D("h2_invXsec_iso_charged2GeV_R05_photons_etaPt","direct iso (charged pt 2 GeV/c in R=0.5) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_charged3GeV_R03_photons_etaPt = new TH2D("h2_invXsec_iso_charged3GeV_R03_photons_etaPt","direct iso (charged pt 3 GeV/c in R=0.3) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_charged3GeV_R04_photons_etaPt = new TH2D("h2_invXsec_iso_charged3GeV_R04_photons_etaPt","direct iso (charged pt 3 GeV/c in R=0.4) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_charged3GeV_R05_photons_etaPt = new TH2D("h2_invXsec_iso_charged3GeV_R05_photons_etaPt","direct iso (charged pt 3 GeV/c in R=0.5) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_full2GeV_R03_photons_etaPt = new TH2D("h2_invXsec_iso_full2GeV_R03_photons_etaPt","direct iso (full pt 2 GeV/c in R=0.3) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_full2GeV_R04_photons_etaPt = new TH2D("h2_invXsec_iso_full2GeV_R04_photons_etaPt","direct iso (full pt 2 GeV/c in R=0.4) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_full2GeV_R05_photons_etaPt = new TH2D("h2_invXsec_iso_full2GeV_R05_photons_etaPt","direct iso (full pt 2 GeV/c in R=0.5) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_full3GeV_R03_photons_etaPt = new TH2D("h2_invXsec_iso_full3GeV_R03_photons_etaPt","direct iso (full pt 3 GeV/c in R=0.3) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_full3GeV_R04_photons_etaPt = new TH2D("h2_invXsec_iso_full3GeV_R04_photons_etaPt","direct iso (full pt 3 GeV/c in R=0.4) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+  TH2D *h2_invXsec_iso_full3GeV_R05_photons_etaPt = new TH2D("h2_invXsec_iso_full3GeV_R05_photons_etaPt","direct iso (full pt 3 GeV/c in R=0.5) photons: |#eta| vs. p_{T}", pyHelp.etaBins, pyHelp.etaBinArray, pyHelp.ptBinsFine, pyHelp.ptBinArrayFine);
+
+
   vector <TH1D*> vec_pTHat_bin;
   vector <TH1D*> vec_weightSum_bin;
+  vector <TH1D*> vec_weightSum_genInfo_bin;
 
   // charged jets
   vector <TH1D*> vec_chJets_pt_etaTPC_bin;
@@ -487,113 +581,51 @@ int main(int argc, char **argv) {
   // organise pTHat wise histograms in vectors
   vector <TH2D*> vec_electron_pt_topMotherID_bin;
 
-  vector <TH1D*> vec_electron_yDefault_bin;
-  vector <TH1D*> vec_electron_etaLarge_bin;
-  vector <TH1D*> vec_electron_etaTPC_bin;
-  vector <TH1D*> vec_electron_etaEMCal_bin;
-  vector <TH1D*> vec_electron_etaPHOS_bin;
+  vector <TH2D*> vec_electron_yPt_bin;
+  vector <TH2D*> vec_electron_etaPt_bin;
   
-  vector <TH1D*> vec_pi0_yDefault_bin;
-  vector <TH1D*> vec_pi0_etaLarge_bin;
-  vector <TH1D*> vec_pi0_etaTPC_bin;
-  vector <TH1D*> vec_pi0_etaEMCal_bin;
-  vector <TH1D*> vec_pi0_etaPHOS_bin;
-
-  vector <TH1D*> vec_pi0primary_yDefault_bin;
-  vector <TH1D*> vec_pi0primary_etaLarge_bin;
-  vector <TH1D*> vec_pi0primary_etaTPC_bin;
-  vector <TH1D*> vec_pi0primary_etaEMCal_bin;
-  vector <TH1D*> vec_pi0primary_etaPHOS_bin;
-
-  vector <TH1D*> vec_eta_yDefault_bin;
-  vector <TH1D*> vec_eta_etaLarge_bin;
-  vector <TH1D*> vec_eta_etaTPC_bin;
-  vector <TH1D*> vec_eta_etaEMCal_bin;
-  vector <TH1D*> vec_eta_etaPHOS_bin;
-
-  vector <TH1D*> vec_etaprime_yDefault_bin;
-  vector <TH1D*> vec_etaprime_etaLarge_bin;
-  vector <TH1D*> vec_etaprime_etaTPC_bin;
-  vector <TH1D*> vec_etaprime_etaEMCal_bin;
-  vector <TH1D*> vec_etaprime_etaPHOS_bin;
-
-  vector <TH1D*> vec_omega_yDefault_bin;
-  vector <TH1D*> vec_omega_etaLarge_bin;
-  vector <TH1D*> vec_omega_etaTPC_bin;
-  vector <TH1D*> vec_omega_etaEMCal_bin;
-  vector <TH1D*> vec_omega_etaPHOS_bin;
-
-  vector <TH1D*> vec_direct_photons_yDefault_bin;
-  vector <TH1D*> vec_direct_photons_etaLarge_bin;
-  vector <TH1D*> vec_direct_photons_etaTPC_bin;
-  vector <TH1D*> vec_direct_photons_etaEMCal_bin;
-  vector <TH1D*> vec_direct_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_shower_photons_yDefault_bin;
-  vector <TH1D*> vec_shower_photons_etaLarge_bin;
-  vector <TH1D*> vec_shower_photons_etaTPC_bin;
-  vector <TH1D*> vec_shower_photons_etaEMCal_bin;
-  vector <TH1D*> vec_shower_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_222_photons_yDefault_bin;
-  vector <TH1D*> vec_222_photons_etaLarge_bin;
-  vector <TH1D*> vec_222_photons_etaTPC_bin;
-  vector <TH1D*> vec_222_photons_etaEMCal_bin;
-  vector <TH1D*> vec_222_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_decay_photons_yDefault_bin;
-  vector <TH1D*> vec_decay_photons_etaLarge_bin;
-  vector <TH1D*> vec_decay_photons_etaTPC_bin;
-  vector <TH1D*> vec_decay_photons_etaEMCal_bin;
-  vector <TH1D*> vec_decay_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_iso_charged2GeV_R03_photons_etaTPC_bin;
-  vector <TH1D*> vec_iso_charged2GeV_R04_photons_etaTPC_bin;
-  vector <TH1D*> vec_iso_charged2GeV_R05_photons_etaTPC_bin;
-
-  vector <TH1D*> vec_iso_charged2GeV_R03_photons_etaEMCal_bin;
-  vector <TH1D*> vec_iso_charged2GeV_R04_photons_etaEMCal_bin;
-  vector <TH1D*> vec_iso_charged2GeV_R05_photons_etaEMCal_bin;
-
-  vector <TH1D*> vec_iso_charged2GeV_R03_photons_etaPHOS_bin;
-  vector <TH1D*> vec_iso_charged2GeV_R04_photons_etaPHOS_bin;
-  vector <TH1D*> vec_iso_charged2GeV_R05_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_iso_charged3GeV_R03_photons_etaTPC_bin;
-  vector <TH1D*> vec_iso_charged3GeV_R04_photons_etaTPC_bin;
-  vector <TH1D*> vec_iso_charged3GeV_R05_photons_etaTPC_bin;
-
-  vector <TH1D*> vec_iso_charged3GeV_R03_photons_etaEMCal_bin;
-  vector <TH1D*> vec_iso_charged3GeV_R04_photons_etaEMCal_bin;
-  vector <TH1D*> vec_iso_charged3GeV_R05_photons_etaEMCal_bin;
-
-  vector <TH1D*> vec_iso_charged3GeV_R03_photons_etaPHOS_bin;
-  vector <TH1D*> vec_iso_charged3GeV_R04_photons_etaPHOS_bin;
-  vector <TH1D*> vec_iso_charged3GeV_R05_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_iso_full2GeV_R03_photons_etaTPC_bin;
-  vector <TH1D*> vec_iso_full2GeV_R04_photons_etaTPC_bin;
-  vector <TH1D*> vec_iso_full2GeV_R05_photons_etaTPC_bin;
-
-  vector <TH1D*> vec_iso_full2GeV_R03_photons_etaEMCal_bin;
-  vector <TH1D*> vec_iso_full2GeV_R04_photons_etaEMCal_bin;
-  vector <TH1D*> vec_iso_full2GeV_R05_photons_etaEMCal_bin;
-
-  vector <TH1D*> vec_iso_full2GeV_R03_photons_etaPHOS_bin;
-  vector <TH1D*> vec_iso_full2GeV_R04_photons_etaPHOS_bin;
-  vector <TH1D*> vec_iso_full2GeV_R05_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_iso_full3GeV_R03_photons_etaTPC_bin;
-  vector <TH1D*> vec_iso_full3GeV_R04_photons_etaTPC_bin;
-  vector <TH1D*> vec_iso_full3GeV_R05_photons_etaTPC_bin;
-
-  vector <TH1D*> vec_iso_full3GeV_R03_photons_etaEMCal_bin;
-  vector <TH1D*> vec_iso_full3GeV_R04_photons_etaEMCal_bin;
-  vector <TH1D*> vec_iso_full3GeV_R05_photons_etaEMCal_bin;
-
-  vector <TH1D*> vec_iso_full3GeV_R03_photons_etaPHOS_bin;
-  vector <TH1D*> vec_iso_full3GeV_R04_photons_etaPHOS_bin;
-  vector <TH1D*> vec_iso_full3GeV_R05_photons_etaPHOS_bin;
+  vector <TH2D*> vec_pi0_yPt_bin;
+  vector <TH2D*> vec_pi0_etaPt_bin;
+
+  vector <TH2D*> vec_pi0primary_yPt_bin;
+  vector <TH2D*> vec_pi0primary_etaPt_bin;
+
+  vector <TH2D*> vec_eta_yPt_bin;
+  vector <TH2D*> vec_eta_etaPt_bin;
+
+  vector <TH2D*> vec_etaprime_yPt_bin;
+  vector <TH2D*> vec_etaprime_etaPt_bin;
+
+  vector <TH2D*> vec_omega_yPt_bin;
+  vector <TH2D*> vec_omega_etaPt_bin;
+
+  vector <TH2D*> vec_direct_photons_yPt_bin;
+  vector <TH2D*> vec_direct_photons_etaPt_bin;
+
+  vector <TH2D*> vec_shower_photons_yPt_bin;
+  vector <TH2D*> vec_shower_photons_etaPt_bin;
+
+  vector <TH2D*> vec_222_photons_yPt_bin;
+  vector <TH2D*> vec_222_photons_etaPt_bin;
+
+  vector <TH2D*> vec_decay_photons_yPt_bin;
+  vector <TH2D*> vec_decay_photons_etaPt_bin;
+
+  vector <TH2D*> vec_iso_charged2GeV_R03_photons_etaPt_bin;
+  vector <TH2D*> vec_iso_charged2GeV_R04_photons_etaPt_bin;
+  vector <TH2D*> vec_iso_charged2GeV_R05_photons_etaPt_bin;
+
+  vector <TH2D*> vec_iso_charged3GeV_R03_photons_etaPt_bin;
+  vector <TH2D*> vec_iso_charged3GeV_R04_photons_etaPt_bin;
+  vector <TH2D*> vec_iso_charged3GeV_R05_photons_etaPt_bin;
+
+  vector <TH2D*> vec_iso_full2GeV_R03_photons_etaPt_bin;
+  vector <TH2D*> vec_iso_full2GeV_R04_photons_etaPt_bin;
+  vector <TH2D*> vec_iso_full2GeV_R05_photons_etaPt_bin;
+
+  vector <TH2D*> vec_iso_full3GeV_R03_photons_etaPt_bin;
+  vector <TH2D*> vec_iso_full3GeV_R04_photons_etaPt_bin;
+  vector <TH2D*> vec_iso_full3GeV_R05_photons_etaPt_bin;
 
   //
   // ─── PLOTS FOR ISOLATION ITSELF ─────────────────────────────────────────────────
@@ -675,111 +707,6 @@ int main(int argc, char **argv) {
   vector<TH1D *> vec_iso_full_R04_all_photons_etaPHOS_bin;
   vector<TH1D *> vec_iso_full_R05_all_photons_etaPHOS_bin;
 
-  //----------------------------------------------------------------------------------------------------
-  // do the same jazz for invariant cross section histos ------------------------------------------
-  //------------------------------------------------------------------------------------------
-  vector <TH1D*> vec_invXsec_pi0_yDefault_bin;
-  vector <TH1D*> vec_invXsec_pi0_etaLarge_bin;
-  vector <TH1D*> vec_invXsec_pi0_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_pi0_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_pi0_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_pi0primary_yDefault_bin;
-  vector <TH1D*> vec_invXsec_pi0primary_etaLarge_bin;
-  vector <TH1D*> vec_invXsec_pi0primary_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_pi0primary_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_pi0primary_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_eta_yDefault_bin;
-  vector <TH1D*> vec_invXsec_eta_etaLarge_bin;
-  vector <TH1D*> vec_invXsec_eta_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_eta_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_eta_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_etaprime_yDefault_bin;
-  vector <TH1D*> vec_invXsec_etaprime_etaLarge_bin;
-  vector <TH1D*> vec_invXsec_etaprime_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_etaprime_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_etaprime_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_omega_yDefault_bin;
-  vector <TH1D*> vec_invXsec_omega_etaLarge_bin;
-  vector <TH1D*> vec_invXsec_omega_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_omega_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_omega_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_direct_photons_yDefault_bin;
-  vector <TH1D*> vec_invXsec_direct_photons_etaLarge_bin;
-  vector <TH1D*> vec_invXsec_direct_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_direct_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_direct_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_shower_photons_yDefault_bin;
-  vector <TH1D*> vec_invXsec_shower_photons_etaLarge_bin;
-  vector <TH1D*> vec_invXsec_shower_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_shower_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_shower_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_222_photons_yDefault_bin;
-  vector <TH1D*> vec_invXsec_222_photons_etaLarge_bin;
-  vector <TH1D*> vec_invXsec_222_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_222_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_222_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_decay_photons_yDefault_bin;
-  vector <TH1D*> vec_invXsec_decay_photons_etaLarge_bin;
-  vector <TH1D*> vec_invXsec_decay_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_decay_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_decay_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_iso_charged2GeV_R03_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_iso_charged2GeV_R04_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_iso_charged2GeV_R05_photons_etaTPC_bin;
-
-  vector <TH1D*> vec_invXsec_iso_charged2GeV_R03_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_iso_charged2GeV_R04_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_iso_charged2GeV_R05_photons_etaEMCal_bin;
-
-  vector <TH1D*> vec_invXsec_iso_charged2GeV_R03_photons_etaPHOS_bin;
-  vector <TH1D*> vec_invXsec_iso_charged2GeV_R04_photons_etaPHOS_bin;
-  vector <TH1D*> vec_invXsec_iso_charged2GeV_R05_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_iso_charged3GeV_R03_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_iso_charged3GeV_R04_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_iso_charged3GeV_R05_photons_etaTPC_bin;
-
-  vector <TH1D*> vec_invXsec_iso_charged3GeV_R03_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_iso_charged3GeV_R04_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_iso_charged3GeV_R05_photons_etaEMCal_bin;
-
-  vector <TH1D*> vec_invXsec_iso_charged3GeV_R03_photons_etaPHOS_bin;
-  vector <TH1D*> vec_invXsec_iso_charged3GeV_R04_photons_etaPHOS_bin;
-  vector <TH1D*> vec_invXsec_iso_charged3GeV_R05_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_iso_full2GeV_R03_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_iso_full2GeV_R04_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_iso_full2GeV_R05_photons_etaTPC_bin;
-
-  vector <TH1D*> vec_invXsec_iso_full2GeV_R03_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_iso_full2GeV_R04_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_iso_full2GeV_R05_photons_etaEMCal_bin;
-
-  vector <TH1D*> vec_invXsec_iso_full2GeV_R03_photons_etaPHOS_bin;
-  vector <TH1D*> vec_invXsec_iso_full2GeV_R04_photons_etaPHOS_bin;
-  vector <TH1D*> vec_invXsec_iso_full2GeV_R05_photons_etaPHOS_bin;
-
-  vector <TH1D*> vec_invXsec_iso_full3GeV_R03_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_iso_full3GeV_R04_photons_etaTPC_bin;
-  vector <TH1D*> vec_invXsec_iso_full3GeV_R05_photons_etaTPC_bin;
-
-  vector <TH1D*> vec_invXsec_iso_full3GeV_R03_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_iso_full3GeV_R04_photons_etaEMCal_bin;
-  vector <TH1D*> vec_invXsec_iso_full3GeV_R05_photons_etaEMCal_bin;
-
-  vector <TH1D*> vec_invXsec_iso_full3GeV_R03_photons_etaPHOS_bin;
-  vector <TH1D*> vec_invXsec_iso_full3GeV_R04_photons_etaPHOS_bin;
-  vector <TH1D*> vec_invXsec_iso_full3GeV_R05_photons_etaPHOS_bin;
-
   //----------------------------------------------------------------------------------------------------
   
   for(int i = 0; i < pTHatBins; i++){
@@ -787,6 +714,7 @@ int main(int argc, char **argv) {
     vec_electron_pt_topMotherID_bin.push_back( (TH2D*)h2_electron_pt_topMotherID->Clone(Form( "h2_electron_pt_topMotherID_bin_%02d", i)) );
 
     vec_weightSum_bin.push_back( (TH1D*)h_weightSum->Clone(Form( "h_weightSum_bin_%02d", i )) );
+    vec_weightSum_genInfo_bin.push_back( pyHelp.Book_Generator_Info(Form( "h_weightSum_genInfo_bin_%02d", i )) );
 
     // charged jets
     vec_chJets_pt_etaTPC_bin.push_back( (TH1D*)h_chJets_pt_etaTPC->Clone(Form("h_chJets_pt_etaTPC_bin_%02d",i)) );
@@ -809,116 +737,58 @@ int main(int argc, char **argv) {
     vec_xSecTriggerGamma_bin.push_back( (TH1D*)h_xSecTriggerGamma->Clone(Form( "h_xSecTriggerGamma_bin_%02d", i )) );
 
     // electrons
-    vec_electron_yDefault_bin.push_back( (TH1D*)h_electron_yDefault->Clone(Form("h_electron_yDefault_bin_%02d",i)) );
-    vec_electron_etaLarge_bin.push_back( (TH1D*)h_electron_etaLarge->Clone(Form("h_electron_etaLarge_bin_%02d",i)) );
-    vec_electron_etaTPC_bin.push_back( (TH1D*)h_electron_etaTPC->Clone(Form("h_electron_etaTPC_bin_%02d",i)) );
-    vec_electron_etaEMCal_bin.push_back( (TH1D*)h_electron_etaEMCal->Clone(Form("h_electron_etaEMCal_bin_%02d",i)) );
-    vec_electron_etaPHOS_bin.push_back( (TH1D*)h_electron_etaPHOS->Clone(Form("h_electron_etaPHOS_bin_%02d",i)) );
+    vec_electron_yPt_bin.push_back( (TH2D*)h2_electron_yPt->Clone(Form("h2_electron_yPt_bin_%02d",i)) );
+    vec_electron_etaPt_bin.push_back( (TH2D*)h2_electron_etaPt->Clone(Form("h2_electron_etaPt_bin_%02d",i)) );
 
     // pi0 histos
-    vec_pi0_yDefault_bin.push_back( (TH1D*)h_pi0_yDefault->Clone(Form("h_pi0_yDefault_bin_%02d",i)) );
-    vec_pi0_etaLarge_bin.push_back( (TH1D*)h_pi0_etaLarge->Clone(Form("h_pi0_etaLarge_bin_%02d",i)) );
-    vec_pi0_etaTPC_bin.push_back( (TH1D*)h_pi0_etaTPC->Clone(Form("h_pi0_etaTPC_bin_%02d",i)) );
-    vec_pi0_etaEMCal_bin.push_back( (TH1D*)h_pi0_etaEMCal->Clone(Form("h_pi0_etaEMCal_bin_%02d",i)) );
-    vec_pi0_etaPHOS_bin.push_back( (TH1D*)h_pi0_etaPHOS->Clone(Form("h_pi0_etaPHOS_bin_%02d",i)) );
+    vec_pi0_yPt_bin.push_back( (TH2D*)h2_pi0_yPt->Clone(Form("h2_pi0_yPt_bin_%02d",i)) );
+    vec_pi0_etaPt_bin.push_back( (TH2D*)h2_pi0_etaPt->Clone(Form("h2_pi0_etaPt_bin_%02d",i)) );
 
     // primary pi0 histos
-    vec_pi0primary_yDefault_bin.push_back( (TH1D*)h_pi0primary_yDefault->Clone(Form("h_pi0primary_yDefault_bin_%02d",i)) );
-    vec_pi0primary_etaLarge_bin.push_back( (TH1D*)h_pi0primary_etaLarge->Clone(Form("h_pi0primary_etaLarge_bin_%02d",i)) );
-    vec_pi0primary_etaTPC_bin.push_back( (TH1D*)h_pi0primary_etaTPC->Clone(Form("h_pi0primary_etaTPC_bin_%02d",i)) );
-    vec_pi0primary_etaEMCal_bin.push_back( (TH1D*)h_pi0primary_etaEMCal->Clone(Form("h_pi0primary_etaEMCal_bin_%02d",i)) );
-    vec_pi0primary_etaPHOS_bin.push_back( (TH1D*)h_pi0primary_etaPHOS->Clone(Form("h_pi0primary_etaPHOS_bin_%02d",i)) );
+    vec_pi0primary_yPt_bin.push_back( (TH2D*)h2_pi0primary_yPt->Clone(Form("h2_pi0primary_yPt_bin_%02d",i)) );
+    vec_pi0primary_etaPt_bin.push_back( (TH2D*)h2_pi0primary_etaPt->Clone(Form("h2_pi0primary_etaPt_bin_%02d",i)) );
 
     // eta histos
-    vec_eta_yDefault_bin.push_back( (TH1D*)h_eta_yDefault->Clone(Form("h_eta_yDefault_bin_%02d",i)) );
-    vec_eta_etaLarge_bin.push_back( (TH1D*)h_eta_etaLarge->Clone(Form("h_eta_etaLarge_bin_%02d",i)) );
-    vec_eta_etaTPC_bin.push_back( (TH1D*)h_eta_etaTPC->Clone(Form("h_eta_etaTPC_bin_%02d",i)) );
-    vec_eta_etaEMCal_bin.push_back( (TH1D*)h_eta_etaEMCal->Clone(Form("h_eta_etaEMCal_bin_%02d",i)) );
-    vec_eta_etaPHOS_bin.push_back( (TH1D*)h_eta_etaPHOS->Clone(Form("h_eta_etaPHOS_bin_%02d",i)) );
+    vec_eta_yPt_bin.push_back( (TH2D*)h2_eta_yPt->Clone(Form("h2_eta_yPt_bin_%02d",i)) );
+    vec_eta_etaPt_bin.push_back( (TH2D*)h2_eta_etaPt->Clone(Form("h2_eta_etaPt_bin_%02d",i)) );
 
     // eta prime histos
-    vec_etaprime_yDefault_bin.push_back( (TH1D*)h_etaprime_yDefault->Clone(Form("h_etaprime_yDefault_bin_%02d",i)) );
-    vec_etaprime_etaLarge_bin.push_back( (TH1D*)h_etaprime_etaLarge->Clone(Form("h_etaprime_etaLarge_bin_%02d",i)) );
-    vec_etaprime_etaTPC_bin.push_back( (TH1D*)h_etaprime_etaTPC->Clone(Form("h_etaprime_etaTPC_bin_%02d",i)) );
-    vec_etaprime_etaEMCal_bin.push_back( (TH1D*)h_etaprime_etaEMCal->Clone(Form("h_etaprime_etaEMCal_bin_%02d",i)) );
-    vec_etaprime_etaPHOS_bin.push_back( (TH1D*)h_etaprime_etaPHOS->Clone(Form("h_etaprime_etaPHOS_bin_%02d",i)) );
+    vec_etaprime_yPt_bin.push_back( (TH2D*)h2_etaprime_yPt->Clone(Form("h2_etaprime_yPt_bin_%02d",i)) );
+    vec_etaprime_etaPt_bin.push_back( (TH2D*)h2_etaprime_etaPt->Clone(Form("h2_etaprime_etaPt_bin_%02d",i)) );
 
     // omega histos
-    vec_omega_yDefault_bin.push_back( (TH1D*)h_omega_yDefault->Clone(Form("h_omega_yDefault_bin_%02d",i)) );
-    vec_omega_etaLarge_bin.push_back( (TH1D*)h_omega_etaLarge->Clone(Form("h_omega_etaLarge_bin_%02d",i)) );
-    vec_omega_etaTPC_bin.push_back( (TH1D*)h_omega_etaTPC->Clone(Form("h_omega_etaTPC_bin_%02d",i)) );
-    vec_omega_etaEMCal_bin.push_back( (TH1D*)h_omega_etaEMCal->Clone(Form("h_omega_etaEMCal_bin_%02d",i)) );
-    vec_omega_etaPHOS_bin.push_back( (TH1D*)h_omega_etaPHOS->Clone(Form("h_omega_etaPHOS_bin_%02d",i)) );
+    vec_omega_yPt_bin.push_back( (TH2D*)h2_omega_yPt->Clone(Form("h2_omega_yPt_bin_%02d",i)) );
+    vec_omega_etaPt_bin.push_back( (TH2D*)h2_omega_etaPt->Clone(Form("h2_omega_etaPt_bin_%02d",i)) );
 
     // direct photon histos
-    vec_direct_photons_yDefault_bin.push_back( (TH1D*)h_direct_photons_yDefault->Clone(Form("h_direct_photons_yDefault_bin_%02d",i)) );
-    vec_direct_photons_etaLarge_bin.push_back( (TH1D*)h_direct_photons_etaLarge->Clone(Form("h_direct_photons_etaLarge_bin_%02d",i)) );
-    vec_direct_photons_etaTPC_bin.push_back( (TH1D*)h_direct_photons_etaTPC->Clone(Form("h_direct_photons_etaTPC_bin_%02d",i)) );
-    vec_direct_photons_etaEMCal_bin.push_back( (TH1D*)h_direct_photons_etaEMCal->Clone(Form("h_direct_photons_etaEMCal_bin_%02d",i)) );
-    vec_direct_photons_etaPHOS_bin.push_back( (TH1D*)h_direct_photons_etaPHOS->Clone(Form("h_direct_photons_etaPHOS_bin_%02d",i)) );
+    vec_direct_photons_yPt_bin.push_back( (TH2D*)h2_direct_photons_yPt->Clone(Form("h2_direct_photons_yPt_bin_%02d",i)) );
+    vec_direct_photons_etaPt_bin.push_back( (TH2D*)h2_direct_photons_etaPt->Clone(Form("h2_direct_photons_etaPt_bin_%02d",i)) );
 
     // discriminating shower and prompt photons
-    vec_shower_photons_yDefault_bin.push_back( (TH1D*)h_direct_photons_yDefault->Clone(Form("h_shower_photons_yDefault_bin_%02d",i)) );
-    vec_shower_photons_etaLarge_bin.push_back( (TH1D*)h_direct_photons_etaLarge->Clone(Form("h_shower_photons_etaLarge_bin_%02d",i)) );
-    vec_shower_photons_etaTPC_bin.push_back( (TH1D*)h_direct_photons_etaTPC->Clone(Form("h_shower_photons_etaTPC_bin_%02d",i)) );
-    vec_shower_photons_etaEMCal_bin.push_back( (TH1D*)h_direct_photons_etaEMCal->Clone(Form("h_shower_photons_etaEMCal_bin_%02d",i)) );
-    vec_shower_photons_etaPHOS_bin.push_back( (TH1D*)h_direct_photons_etaPHOS->Clone(Form("h_shower_photons_etaPHOS_bin_%02d",i)) );
-
-    vec_222_photons_yDefault_bin.push_back( (TH1D*)h_direct_photons_yDefault->Clone(Form("h_222_photons_yDefault_bin_%02d",i)) );
-    vec_222_photons_etaLarge_bin.push_back( (TH1D*)h_direct_photons_etaLarge->Clone(Form("h_222_photons_etaLarge_bin_%02d",i)) );
-    vec_222_photons_etaTPC_bin.push_back( (TH1D*)h_direct_photons_etaTPC->Clone(Form("h_222_photons_etaTPC_bin_%02d",i)) );
-    vec_222_photons_etaEMCal_bin.push_back( (TH1D*)h_direct_photons_etaEMCal->Clone(Form("h_222_photons_etaEMCal_bin_%02d",i)) );
-    vec_222_photons_etaPHOS_bin.push_back( (TH1D*)h_direct_photons_etaPHOS->Clone(Form("h_222_photons_etaPHOS_bin_%02d",i)) );
+    vec_shower_photons_yPt_bin.push_back( (TH2D*)h2_shower_photons_yPt->Clone(Form("h2_shower_photons_yPt_bin_%02d",i)) );
+    vec_shower_photons_etaPt_bin.push_back( (TH2D*)h2_shower_photons_etaPt->Clone(Form("h2_shower_photons_etaPt_bin_%02d",i)) );
+
+    vec_222_photons_yPt_bin.push_back( (TH2D*)h2_222_photons_yPt->Clone(Form("h2_222_photons_yPt_bin_%02d",i)) );
+    vec_222_photons_etaPt_bin.push_back( (TH2D*)h2_222_photons_etaPt->Clone(Form("h2_222_photons_etaPt_bin_%02d",i)) );
 
     // decay photon histos
-    vec_decay_photons_yDefault_bin.push_back( (TH1D*)h_decay_photons_yDefault->Clone(Form("h_decay_photons_yDefault_bin_%02d",i)) );
-    vec_decay_photons_etaLarge_bin.push_back( (TH1D*)h_decay_photons_etaLarge->Clone(Form("h_decay_photons_etaLarge_bin_%02d",i)) );
-    vec_decay_photons_etaTPC_bin.push_back( (TH1D*)h_decay_photons_etaTPC->Clone(Form("h_decay_photons_etaTPC_bin_%02d",i)) );
-    vec_decay_photons_etaEMCal_bin.push_back( (TH1D*)h_decay_photons_etaEMCal->Clone(Form("h_decay_photons_etaEMCal_bin_%02d",i)) );
-    vec_decay_photons_etaPHOS_bin.push_back( (TH1D*)h_decay_photons_etaPHOS->Clone(Form("h_decay_photons_etaPHOS_bin_%02d",i)) );
+    vec_decay_photons_yPt_bin.push_back( (TH2D*)h2_decay_photons_yPt->Clone(Form("h2_decay_photons_yPt_bin_%02d",i)) );
+    vec_decay_photons_etaPt_bin.push_back( (TH2D*)h2_decay_photons_etaPt->Clone(Form("h2_decay_photons_etaPt_bin_%02d",i)) );
 
     if(producePhotonIsoSpectra){
-      // isolated photon histos TPC
-      vec_iso_charged2GeV_R03_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged2GeV_R03_photons_etaTPC->Clone(Form("h_iso_charged2GeV_R03_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_charged2GeV_R04_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged2GeV_R04_photons_etaTPC->Clone(Form("h_iso_charged2GeV_R04_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_charged2GeV_R05_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged2GeV_R05_photons_etaTPC->Clone(Form("h_iso_charged2GeV_R05_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_charged3GeV_R03_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged3GeV_R03_photons_etaTPC->Clone(Form("h_iso_charged3GeV_R03_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_charged3GeV_R04_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged3GeV_R04_photons_etaTPC->Clone(Form("h_iso_charged3GeV_R04_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_charged3GeV_R05_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged3GeV_R05_photons_etaTPC->Clone(Form("h_iso_charged3GeV_R05_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_full2GeV_R03_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full2GeV_R03_photons_etaTPC->Clone(Form("h_iso_full2GeV_R03_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_full2GeV_R04_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full2GeV_R04_photons_etaTPC->Clone(Form("h_iso_full2GeV_R04_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_full2GeV_R05_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full2GeV_R05_photons_etaTPC->Clone(Form("h_iso_full2GeV_R05_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_full3GeV_R03_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full3GeV_R03_photons_etaTPC->Clone(Form("h_iso_full3GeV_R03_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_full3GeV_R04_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full3GeV_R04_photons_etaTPC->Clone(Form("h_iso_full3GeV_R04_photons_etaTPC_bin_%02d",i)) );
-      vec_iso_full3GeV_R05_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full3GeV_R05_photons_etaTPC->Clone(Form("h_iso_full3GeV_R05_photons_etaTPC_bin_%02d",i)) );
-
-      // isolated photon histos EMCAL
-      vec_iso_charged2GeV_R03_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged2GeV_R03_photons_etaEMCal->Clone(Form("h_iso_charged2GeV_R03_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_charged2GeV_R04_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged2GeV_R04_photons_etaEMCal->Clone(Form("h_iso_charged2GeV_R04_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_charged2GeV_R05_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged2GeV_R05_photons_etaEMCal->Clone(Form("h_iso_charged2GeV_R05_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_charged3GeV_R03_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged3GeV_R03_photons_etaEMCal->Clone(Form("h_iso_charged3GeV_R03_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_charged3GeV_R04_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged3GeV_R04_photons_etaEMCal->Clone(Form("h_iso_charged3GeV_R04_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_charged3GeV_R05_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged3GeV_R05_photons_etaEMCal->Clone(Form("h_iso_charged3GeV_R05_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_full2GeV_R03_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full2GeV_R03_photons_etaEMCal->Clone(Form("h_iso_full2GeV_R03_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_full2GeV_R04_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full2GeV_R04_photons_etaEMCal->Clone(Form("h_iso_full2GeV_R04_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_full2GeV_R05_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full2GeV_R05_photons_etaEMCal->Clone(Form("h_iso_full2GeV_R05_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_full3GeV_R03_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full3GeV_R03_photons_etaEMCal->Clone(Form("h_iso_full3GeV_R03_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_full3GeV_R04_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full3GeV_R04_photons_etaEMCal->Clone(Form("h_iso_full3GeV_R04_photons_etaEMCal_bin_%02d",i)) );
-      vec_iso_full3GeV_R05_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full3GeV_R05_photons_etaEMCal->Clone(Form("h_iso_full3GeV_R05_photons_etaEMCal_bin_%02d",i)) );
-
-      // isolated photon histos PHOS
-      vec_iso_charged2GeV_R03_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged2GeV_R03_photons_etaPHOS->Clone(Form("h_iso_charged2GeV_R03_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_charged2GeV_R04_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged2GeV_R04_photons_etaPHOS->Clone(Form("h_iso_charged2GeV_R04_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_charged2GeV_R05_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged2GeV_R05_photons_etaPHOS->Clone(Form("h_iso_charged2GeV_R05_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_charged3GeV_R03_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged3GeV_R03_photons_etaPHOS->Clone(Form("h_iso_charged3GeV_R03_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_charged3GeV_R04_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged3GeV_R04_photons_etaPHOS->Clone(Form("h_iso_charged3GeV_R04_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_charged3GeV_R05_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged3GeV_R05_photons_etaPHOS->Clone(Form("h_iso_charged3GeV_R05_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_full2GeV_R03_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full2GeV_R03_photons_etaPHOS->Clone(Form("h_iso_full2GeV_R03_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_full2GeV_R04_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full2GeV_R04_photons_etaPHOS->Clone(Form("h_iso_full2GeV_R04_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_full2GeV_R05_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full2GeV_R05_photons_etaPHOS->Clone(Form("h_iso_full2GeV_R05_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_full3GeV_R03_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full3GeV_R03_photons_etaPHOS->Clone(Form("h_iso_full3GeV_R03_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_full3GeV_R04_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full3GeV_R04_photons_etaPHOS->Clone(Form("h_iso_full3GeV_R04_photons_etaPHOS_bin_%02d",i)) );
-      vec_iso_full3GeV_R05_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full3GeV_R05_photons_etaPHOS->Clone(Form("h_iso_full3GeV_R05_photons_etaPHOS_bin_%02d",i)) );
+      // isolated photon histos (|eta| x pt within TPC acceptance, EMCal/PHOS are projected from them)
+      vec_iso_charged2GeV_R03_photons_etaPt_bin.push_back( (TH2D*)h2_iso_charged2GeV_R03_photons_etaPt->Clone(Form("h2_iso_charged2GeV_R03_photons_etaPt_bin_%02d",i)) );
+      vec_iso_charged2GeV_R04_photons_etaPt_bin.push_back( (TH2D*)h2_iso_charged2GeV_R04_photons_etaPt->Clone(Form("h2_iso_charged2GeV_R04_photons_etaPt_bin_%02d",i)) );
+      vec_iso_charged2GeV_R05_photons_etaPt_bin.push_back( (TH2D*)h2_iso_charged2GeV_R05_photons_etaPt->Clone(Form("h2_iso_charged2GeV_R05_photons_etaPt_bin_%02d",i)) );
+      vec_iso_charged3GeV_R03_photons_etaPt_bin.push_back( (TH2D*)h2_iso_charged3GeV_R03_photons_etaPt->Clone(Form("h2_iso_charged3GeV_R03_photons_etaPt_bin_%02d",i)) );
+      vec_iso_charged3GeV_R04_photons_etaPt_bin.push_back( (TH2D*)h2_iso_charged3GeV_R04_photons_etaPt->Clone(Form("h2_iso_charged3GeV_R04_photons_etaPt_bin_%02d",i)) );
+      vec_iso_charged3GeV_R05_photons_etaPt_bin.push_back( (TH2D*)h2_iso_charged3GeV_R05_photons_etaPt->Clone(Form("h2_iso_charged3GeV_R05_photons_etaPt_bin_%02d",i)) );
+      vec_iso_full2GeV_R03_photons_etaPt_bin.push_back( (TH2D*)h2_iso_full2GeV_R03_photons_etaPt->Clone(Form("h2_iso_full2GeV_R03_photons_etaPt_bin_%02d",i)) );
+      vec_iso_full2GeV_R04_photons_etaPt_bin.push_back( (TH2D*)h2_iso_full2GeV_R04_photons_etaPt->Clone(Form("h2_iso_full2GeV_R04_photons_etaPt_bin_%02d",i)) );
+      vec_iso_full2GeV_R05_photons_etaPt_bin.push_back( (TH2D*)h2_iso_full2GeV_R05_photons_etaPt->Clone(Form("h2_iso_full2GeV_R05_photons_etaPt_bin_%02d",i)) );
+      vec_iso_full3GeV_R03_photons_etaPt_bin.push_back( (TH2D*)h2_iso_full3GeV_R03_photons_etaPt->Clone(Form("h2_iso_full3GeV_R03_photons_etaPt_bin_%02d",i)) );
+      vec_iso_full3GeV_R04_photons_etaPt_bin.push_back( (TH2D*)h2_iso_full3GeV_R04_photons_etaPt->Clone(Form("h2_iso_full3GeV_R04_photons_etaPt_bin_%02d",i)) );
+      vec_iso_full3GeV_R05_photons_etaPt_bin.push_back( (TH2D*)h2_iso_full3GeV_R05_photons_etaPt->Clone(Form("h2_iso_full3GeV_R05_photons_etaPt_bin_%02d",i)) );
 
       //
       // ─── SUM OF PT IN CONE ───────────────────────────────────────────
@@ -999,142 +869,266 @@ int main(int argc, char **argv) {
 
 
     //----------------------------------------------------------------------------------------------------
-    // do the same jazz for invariant cross section histos ------------------------------------------
-    //------------------------------------------------------------------------------------------
-    // pi0 histos
-    vec_invXsec_pi0_yDefault_bin.push_back( (TH1D*)h_invXsec_pi0_yDefault->Clone(Form("h_invXsec_pi0_yDefault_bin_%02d",i)) );
-    vec_invXsec_pi0_etaLarge_bin.push_back( (TH1D*)h_invXsec_pi0_etaLarge->Clone(Form("h_invXsec_pi0_etaLarge_bin_%02d",i)) );
-    vec_invXsec_pi0_etaTPC_bin.push_back( (TH1D*)h_invXsec_pi0_etaTPC->Clone(Form("h_invXsec_pi0_etaTPC_bin_%02d",i)) );
-    vec_invXsec_pi0_etaEMCal_bin.push_back( (TH1D*)h_invXsec_pi0_etaEMCal->Clone(Form("h_invXsec_pi0_etaEMCal_bin_%02d",i)) );
-    vec_invXsec_pi0_etaPHOS_bin.push_back( (TH1D*)h_invXsec_pi0_etaPHOS->Clone(Form("h_invXsec_pi0_etaPHOS_bin_%02d",i)) );
+    vec_pTHat_bin.push_back( (TH1D*)h_pTHat->Clone(Form("h_pTHat_bin_%02d",i)) );
 
-    // primary pi0 histos
-    vec_invXsec_pi0primary_yDefault_bin.push_back( (TH1D*)h_invXsec_pi0primary_yDefault->Clone(Form("h_invXsec_pi0primary_yDefault_bin_%02d",i)) );
-    vec_invXsec_pi0primary_etaLarge_bin.push_back( (TH1D*)h_invXsec_pi0primary_etaLarge->Clone(Form("h_invXsec_pi0primary_etaLarge_bin_%02d",i)) );
-    vec_invXsec_pi0primary_etaTPC_bin.push_back( (TH1D*)h_invXsec_pi0primary_etaTPC->Clone(Form("h_invXsec_pi0primary_etaTPC_bin_%02d",i)) );
-    vec_invXsec_pi0primary_etaEMCal_bin.push_back( (TH1D*)h_invXsec_pi0primary_etaEMCal->Clone(Form("h_invXsec_pi0primary_etaEMCal_bin_%02d",i)) );
-    vec_invXsec_pi0primary_etaPHOS_bin.push_back( (TH1D*)h_invXsec_pi0primary_etaPHOS->Clone(Form("h_invXsec_pi0primary_etaPHOS_bin_%02d",i)) );
+  }
 
-    // eta histos
-    vec_invXsec_eta_yDefault_bin.push_back( (TH1D*)h_invXsec_eta_yDefault->Clone(Form("h_invXsec_eta_yDefault_bin_%02d",i)) );
-    vec_invXsec_eta_etaLarge_bin.push_back( (TH1D*)h_invXsec_eta_etaLarge->Clone(Form("h_invXsec_eta_etaLarge_bin_%02d",i)) );
-    vec_invXsec_eta_etaTPC_bin.push_back( (TH1D*)h_invXsec_eta_etaTPC->Clone(Form("h_invXsec_eta_etaTPC_bin_%02d",i)) );
-    vec_invXsec_eta_etaEMCal_bin.push_back( (TH1D*)h_invXsec_eta_etaEMCal->Clone(Form("h_invXsec_eta_etaEMCal_bin_%02d",i)) );
-    vec_invXsec_eta_etaPHOS_bin.push_back( (TH1D*)h_invXsec_eta_etaPHOS->Clone(Form("h_invXsec_eta_etaPHOS_bin_%02d",i)) );
+  // sum up 1/pT moments together with the "normal" spectra -> invXsec histos are derived from them when writing to file
+  pyHelp.Book_InvXsec_Moments(vec_pi0_yPt_bin);
+  pyHelp.Book_InvXsec_Moments(vec_pi0_etaPt_bin);
 
-    // eta prime histos
-    vec_invXsec_etaprime_yDefault_bin.push_back( (TH1D*)h_invXsec_etaprime_yDefault->Clone(Form("h_invXsec_etaprime_yDefault_bin_%02d",i)) );
-    vec_invXsec_etaprime_etaLarge_bin.push_back( (TH1D*)h_invXsec_etaprime_etaLarge->Clone(Form("h_invXsec_etaprime_etaLarge_bin_%02d",i)) );
-    vec_invXsec_etaprime_etaTPC_bin.push_back( (TH1D*)h_invXsec_etaprime_etaTPC->Clone(Form("h_invXsec_etaprime_etaTPC_bin_%02d",i)) );
-    vec_invXsec_etaprime_etaEMCal_bin.push_back( (TH1D*)h_invXsec_etaprime_etaEMCal->Clone(Form("h_invXsec_etaprime_etaEMCal_bin_%02d",i)) );
-    vec_invXsec_etaprime_etaPHOS_bin.push_back( (TH1D*)h_invXsec_etaprime_etaPHOS->Clone(Form("h_invXsec_etaprime_etaPHOS_bin_%02d",i)) );
+  pyHelp.Book_InvXsec_Moments(vec_pi0primary_yPt_bin);
+  pyHelp.Book_InvXsec_Moments(vec_pi0primary_etaPt_bin);
 
-    // omega histos
-    vec_invXsec_omega_yDefault_bin.push_back( (TH1D*)h_invXsec_omega_yDefault->Clone(Form("h_invXsec_omega_yDefault_bin_%02d",i)) );
-    vec_invXsec_omega_etaLarge_bin.push_back( (TH1D*)h_invXsec_omega_etaLarge->Clone(Form("h_invXsec_omega_etaLarge_bin_%02d",i)) );
-    vec_invXsec_omega_etaTPC_bin.push_back( (TH1D*)h_invXsec_omega_etaTPC->Clone(Form("h_invXsec_omega_etaTPC_bin_%02d",i)) );
-    vec_invXsec_omega_etaEMCal_bin.push_back( (TH1D*)h_invXsec_omega_etaEMCal->Clone(Form("h_invXsec_omega_etaEMCal_bin_%02d",i)) );
-    vec_invXsec_omega_etaPHOS_bin.push_back( (TH1D*)h_invXsec_omega_etaPHOS->Clone(Form("h_invXsec_omega_etaPHOS_bin_%02d",i)) );
+  pyHelp.Book_InvXsec_Moments(vec_eta_yPt_bin);
+  pyHelp.Book_InvXsec_Moments(vec_eta_etaPt_bin);
 
-    // direct photon histos
-    vec_invXsec_direct_photons_yDefault_bin.push_back( (TH1D*)h_invXsec_direct_photons_yDefault->Clone(Form("h_invXsec_direct_photons_yDefault_bin_%02d",i)) );
-    vec_invXsec_direct_photons_etaLarge_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaLarge->Clone(Form("h_invXsec_direct_photons_etaLarge_bin_%02d",i)) );
-    vec_invXsec_direct_photons_etaTPC_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaTPC->Clone(Form("h_invXsec_direct_photons_etaTPC_bin_%02d",i)) );
-    vec_invXsec_direct_photons_etaEMCal_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaEMCal->Clone(Form("h_invXsec_direct_photons_etaEMCal_bin_%02d",i)) );
-    vec_invXsec_direct_photons_etaPHOS_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaPHOS->Clone(Form("h_invXsec_direct_photons_etaPHOS_bin_%02d",i)) );
+  pyHelp.Book_InvXsec_Moments(vec_etaprime_yPt_bin);
+  pyHelp.Book_InvXsec_Moments(vec_etaprime_etaPt_bin);
 
-    // discriminating shower and prompt photons
-    vec_invXsec_shower_photons_yDefault_bin.push_back( (TH1D*)h_invXsec_direct_photons_yDefault->Clone(Form("h_invXsec_shower_photons_yDefault_bin_%02d",i)) );
-    vec_invXsec_shower_photons_etaLarge_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaLarge->Clone(Form("h_invXsec_shower_photons_etaLarge_bin_%02d",i)) );
-    vec_invXsec_shower_photons_etaTPC_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaTPC->Clone(Form("h_invXsec_shower_photons_etaTPC_bin_%02d",i)) );
-    vec_invXsec_shower_photons_etaEMCal_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaEMCal->Clone(Form("h_invXsec_shower_photons_etaEMCal_bin_%02d",i)) );
-    vec_invXsec_shower_photons_etaPHOS_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaPHOS->Clone(Form("h_invXsec_shower_photons_etaPHOS_bin_%02d",i)) );
-
-    vec_invXsec_222_photons_yDefault_bin.push_back( (TH1D*)h_invXsec_direct_photons_yDefault->Clone(Form("h_invXsec_222_photons_yDefault_bin_%02d",i)) );
-    vec_invXsec_222_photons_etaLarge_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaLarge->Clone(Form("h_invXsec_222_photons_etaLarge_bin_%02d",i)) );
-    vec_invXsec_222_photons_etaTPC_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaTPC->Clone(Form("h_invXsec_222_photons_etaTPC_bin_%02d",i)) );
-    vec_invXsec_222_photons_etaEMCal_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaEMCal->Clone(Form("h_invXsec_222_photons_etaEMCal_bin_%02d",i)) );
-    vec_invXsec_222_photons_etaPHOS_bin.push_back( (TH1D*)h_invXsec_direct_photons_etaPHOS->Clone(Form("h_invXsec_222_photons_etaPHOS_bin_%02d",i)) );
+  pyHelp.Book_InvXsec_Moments(vec_omega_yPt_bin);
+  pyHelp.Book_InvXsec_Moments(vec_omega_etaPt_bin);
 
-    // decay photon histos
-    vec_invXsec_decay_photons_yDefault_bin.push_back( (TH1D*)h_decay_photons_yDefault->Clone(Form("h_invXsec_decay_photons_yDefault_bin_%02d",i)) );
-    vec_invXsec_decay_photons_etaLarge_bin.push_back( (TH1D*)h_decay_photons_etaLarge->Clone(Form("h_invXsec_decay_photons_etaLarge_bin_%02d",i)) );
-    vec_invXsec_decay_photons_etaTPC_bin.push_back( (TH1D*)h_decay_photons_etaTPC->Clone(Form("h_invXsec_decay_photons_etaTPC_bin_%02d",i)) );
-    vec_invXsec_decay_photons_etaEMCal_bin.push_back( (TH1D*)h_decay_photons_etaEMCal->Clone(Form("h_invXsec_decay_photons_etaEMCal_bin_%02d",i)) );
-    vec_invXsec_decay_photons_etaPHOS_bin.push_back( (TH1D*)h_decay_photons_etaPHOS->Clone(Form("h_invXsec_decay_photons_etaPHOS_bin_%02d",i)) );
+  pyHelp.Book_InvXsec_Moments(vec_direct_photons_yPt_bin);
+  pyHelp.Book_InvXsec_Moments(vec_direct_photons_etaPt_bin);
 
+  pyHelp.Book_InvXsec_Moments(vec_shower_photons_yPt_bin);
+  pyHelp.Book_InvXsec_Moments(vec_shower_photons_etaPt_bin);
 
-    if(producePhotonIsoSpectra){
-      // isolated photon histos TPC
-      vec_invXsec_iso_charged2GeV_R03_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged2GeV_R03_photons_etaTPC->Clone(Form("h_invXsec_iso_charged2GeV_R03_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_charged2GeV_R04_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged2GeV_R04_photons_etaTPC->Clone(Form("h_invXsec_iso_charged2GeV_R04_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_charged2GeV_R05_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged2GeV_R05_photons_etaTPC->Clone(Form("h_invXsec_iso_charged2GeV_R05_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_charged3GeV_R03_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged3GeV_R03_photons_etaTPC->Clone(Form("h_invXsec_iso_charged3GeV_R03_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_charged3GeV_R04_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged3GeV_R04_photons_etaTPC->Clone(Form("h_invXsec_iso_charged3GeV_R04_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_charged3GeV_R05_photons_etaTPC_bin.push_back( (TH1D*)h_iso_charged3GeV_R05_photons_etaTPC->Clone(Form("h_invXsec_iso_charged3GeV_R05_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_full2GeV_R03_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full2GeV_R03_photons_etaTPC->Clone(Form("h_invXsec_iso_full2GeV_R03_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_full2GeV_R04_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full2GeV_R04_photons_etaTPC->Clone(Form("h_invXsec_iso_full2GeV_R04_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_full2GeV_R05_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full2GeV_R05_photons_etaTPC->Clone(Form("h_invXsec_iso_full2GeV_R05_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_full3GeV_R03_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full3GeV_R03_photons_etaTPC->Clone(Form("h_invXsec_iso_full3GeV_R03_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_full3GeV_R04_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full3GeV_R04_photons_etaTPC->Clone(Form("h_invXsec_iso_full3GeV_R04_photons_etaTPC_bin_%02d",i)) );
-      vec_invXsec_iso_full3GeV_R05_photons_etaTPC_bin.push_back( (TH1D*)h_iso_full3GeV_R05_photons_etaTPC->Clone(Form("h_invXsec_iso_full3GeV_R05_photons_etaTPC_bin_%02d",i)) );
-
-      // isolated photon histos EMCAL
-      vec_invXsec_iso_charged2GeV_R03_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged2GeV_R03_photons_etaEMCal->Clone(Form("h_invXsec_iso_charged2GeV_R03_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_charged2GeV_R04_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged2GeV_R04_photons_etaEMCal->Clone(Form("h_invXsec_iso_charged2GeV_R04_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_charged2GeV_R05_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged2GeV_R05_photons_etaEMCal->Clone(Form("h_invXsec_iso_charged2GeV_R05_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_charged3GeV_R03_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged3GeV_R03_photons_etaEMCal->Clone(Form("h_invXsec_iso_charged3GeV_R03_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_charged3GeV_R04_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged3GeV_R04_photons_etaEMCal->Clone(Form("h_invXsec_iso_charged3GeV_R04_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_charged3GeV_R05_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_charged3GeV_R05_photons_etaEMCal->Clone(Form("h_invXsec_iso_charged3GeV_R05_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_full2GeV_R03_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full2GeV_R03_photons_etaEMCal->Clone(Form("h_invXsec_iso_full2GeV_R03_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_full2GeV_R04_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full2GeV_R04_photons_etaEMCal->Clone(Form("h_invXsec_iso_full2GeV_R04_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_full2GeV_R05_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full2GeV_R05_photons_etaEMCal->Clone(Form("h_invXsec_iso_full2GeV_R05_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_full3GeV_R03_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full3GeV_R03_photons_etaEMCal->Clone(Form("h_invXsec_iso_full3GeV_R03_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_full3GeV_R04_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full3GeV_R04_photons_etaEMCal->Clone(Form("h_invXsec_iso_full3GeV_R04_photons_etaEMCal_bin_%02d",i)) );
-      vec_invXsec_iso_full3GeV_R05_photons_etaEMCal_bin.push_back( (TH1D*)h_iso_full3GeV_R05_photons_etaEMCal->Clone(Form("h_invXsec_iso_full3GeV_R05_photons_etaEMCal_bin_%02d",i)) );
-
-      // isolated photon histos PHOS
-      vec_invXsec_iso_charged2GeV_R03_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged2GeV_R03_photons_etaPHOS->Clone(Form("h_invXsec_iso_charged2GeV_R03_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_charged2GeV_R04_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged2GeV_R04_photons_etaPHOS->Clone(Form("h_invXsec_iso_charged2GeV_R04_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_charged2GeV_R05_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged2GeV_R05_photons_etaPHOS->Clone(Form("h_invXsec_iso_charged2GeV_R05_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_charged3GeV_R03_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged3GeV_R03_photons_etaPHOS->Clone(Form("h_invXsec_iso_charged3GeV_R03_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_charged3GeV_R04_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged3GeV_R04_photons_etaPHOS->Clone(Form("h_invXsec_iso_charged3GeV_R04_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_charged3GeV_R05_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_charged3GeV_R05_photons_etaPHOS->Clone(Form("h_invXsec_iso_charged3GeV_R05_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_full2GeV_R03_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full2GeV_R03_photons_etaPHOS->Clone(Form("h_invXsec_iso_full2GeV_R03_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_full2GeV_R04_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full2GeV_R04_photons_etaPHOS->Clone(Form("h_invXsec_iso_full2GeV_R04_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_full2GeV_R05_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full2GeV_R05_photons_etaPHOS->Clone(Form("h_invXsec_iso_full2GeV_R05_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_full3GeV_R03_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full3GeV_R03_photons_etaPHOS->Clone(Form("h_invXsec_iso_full3GeV_R03_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_full3GeV_R04_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full3GeV_R04_photons_etaPHOS->Clone(Form("h_invXsec_iso_full3GeV_R04_photons_etaPHOS_bin_%02d",i)) );
-      vec_invXsec_iso_full3GeV_R05_photons_etaPHOS_bin.push_back( (TH1D*)h_iso_full3GeV_R05_photons_etaPHOS->Clone(Form("h_invXsec_iso_full3GeV_R05_photons_etaPHOS_bin_%02d",i)) );
-    }
+  pyHelp.Book_InvXsec_Moments(vec_222_photons_yPt_bin);
+  pyHelp.Book_InvXsec_Moments(vec_222_photons_etaPt_bin);
 
+  pyHelp.Book_InvXsec_Moments(vec_decay_photons_yPt_bin);
+  pyHelp.Book_InvXsec_Moments(vec_decay_photons_etaPt_bin);
 
-    //----------------------------------------------------------------------------------------------------
-    vec_pTHat_bin.push_back( (TH1D*)h_pTHat->Clone(Form("h_pTHat_bin_%02d",i)) );
+  if(producePhotonIsoSpectra){
+    pyHelp.Book_InvXsec_Moments(vec_iso_charged2GeV_R03_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_charged2GeV_R04_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_charged2GeV_R05_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_charged3GeV_R03_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_charged3GeV_R04_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_charged3GeV_R05_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_full2GeV_R03_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_full2GeV_R04_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_full2GeV_R05_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_full3GeV_R03_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_full3GeV_R04_photons_etaPt_bin);
+    pyHelp.Book_InvXsec_Moments(vec_iso_full3GeV_R05_photons_etaPt_bin);
+  }
+
+  //--- fork-server mode ----------------------------------
+  // FORKWORKERS = n (e.g. 64): every pTHat bin is initialised once (XML database, PDF grids, MPI tables) and n workers
+  // sharing that memory are forked from it, each generating the events of one task with its own seed; the output
+  // contains the events of all n workers (no checkpoints, event store or weight log, the workers are separate processes)
+  int forkWorkers = getenv("FORKWORKERS") && !getenv("REPLAY") && !getenv("REGENERATE") && pyHelp.Get_MPI_Size() == 1 ? strtol(getenv("FORKWORKERS"), NULL, 10) : 0;
+  if(forkWorkers > 1) printf("\nFork-server mode with %d workers per pTHat bin\n", forkWorkers);
+  else forkWorkers = 0;
+
+  //--- checkpoints ----------------------------------
+  // CHECKPOINT = interval in seconds (e.g. 1800): the run is snapshotted to checkpoint_<output>.root
+  // regularly and after each pTHat bin; a restarted job with the same arguments continues from there
+  // (MPI mode: only after each pTHat bin, the ranks have to stay in the same bin; rank 0 writes the sum of all
+  // ranks to checkpoint_<output>.root, i.e. the state of the whole campaign, and resumes with it)
+  int checkpointInterval = getenv("CHECKPOINT") && !getenv("REPLAY") && !getenv("REGENERATE") && !forkWorkers ? strtol(getenv("CHECKPOINT"), NULL, 10) : 0;
+  TString checkpointName = pyHelp.Get_MPI_Size() > 1 ? TString(rootFileName) : sideFileName;
+  checkpointName.Insert(checkpointName.Last('/')+1, "checkpoint_");
+  TString runID;
+  for(int i = 1; i < argc; i++) runID += Form("%s ", argv[i]);
+  runID += pyHelp.ptBinningName.c_str();
+  if( pyHelp.Get_MPI_Size() > 1 ) runID += Form(" %d MPI ranks", pyHelp.Get_MPI_Size());
+  int resumeBin = -1, resumeEvent = 0;
+  if( checkpointInterval > 0 ){
+    bool isResumed = pyHelp.Get_MPI_Size() > 1 ? pyHelp.Read_Checkpoint_MPI(checkpointName, runID, resumeBin)
+      : pyHelp.Read_Checkpoint(checkpointName, runID, resumeBin, resumeEvent);
+    if(!isResumed) resumeBin = -1;
+  }
+  time_t lastCheckpoint = time(0);
+
+  // checkpoints and the final histograms are written by a background thread from copies
+  // (fork-server mode: started after the bin loop, a thread running at fork() can leave a worker with a locked mutex)
+  if(!forkWorkers) pyHelp.Start_Writer();
+
+  //--- event store and replay ----------------------------------
+  // EVENTSTORE = |eta| limit (e.g. 1.5) or "all": the accepted events are stored particle-level to events_<output>.root
+  // REPLAY = event store file(s), wildcards allowed: the analysis runs over the stored events instead of generating them,
+  // with the same arguments as the generation (number of events ignored) but e.g. another PTBINNING;
+  // REPLAY_CHUNK = i/n analyses chunk i of n of the events of every pTHat bin (see replay_PythiaAnalysis.sh)
+  bool isReplay = getenv("REPLAY");
+  if(isReplay){
+    int iChunk = 0, nChunks = 1;
+    if( getenv("REPLAY_CHUNK") && sscanf(getenv("REPLAY_CHUNK"), "%d/%d", &iChunk, &nChunks) != 2 ){
+      printf("REPLAY_CHUNK has to be i/n. Aborting...\n");
+      exit(EXIT_FAILURE);
+    }
+    if( !pyHelp.Open_Replay(getenv("REPLAY"), iChunk, nChunks) )
+      exit(EXIT_FAILURE);
+    p.event.init("(replayed event)", &p.particleData); // no p.init() in a replay
+  }
+  bool useEventStore = getenv("EVENTSTORE") && !isReplay && !forkWorkers;
+  if( useEventStore && resumeBin >= 0 ){
+    printf("resumed run: the event store is not continued\n");
+    useEventStore = false;
+  }
+  if(useEventStore){
+    TString storeName = sideFileName;
+    storeName.Insert(storeName.Last('/')+1, "events_");
+    double storeEtaMax = strcmp(getenv("EVENTSTORE"),"all") ? strtod(getenv("EVENTSTORE"), NULL) : -1.;
+    if( !pyHelp.Open_Event_Store(storeName, storeEtaMax) )
+      exit(EXIT_FAILURE);
+  }
 
+  // WEIGHTLOG = 1: event number, pTHat, leading direct photon pT, weights, seed and MBVeto flag of every event to weightlog_<output>.root
+  bool useWeightLog = getenv("WEIGHTLOG") && strcmp(getenv("WEIGHTLOG"),"0") && !isReplay && !forkWorkers;
+  if( useWeightLog && resumeBin >= 0 ){
+    printf("resumed run: the weight log is not continued\n");
+    useWeightLog = false;
+  }
+  if(useWeightLog){
+    TString weightLogName = sideFileName;
+    weightLogName.Insert(weightLogName.Last('/')+1, "weightlog_");
+    if( !pyHelp.Open_Weight_Log(weightLogName) )
+      exit(EXIT_FAILURE);
+  }
+  long seed = p.settings.mode("Random:seed");
+
+  //--- per-event seeds and regeneration ----------------------------------
+  // EVENTSEEDS = 1: every event is generated with its own seed from (job seed, pTHat bin, event index), see the weight log
+  // REGENERATE = event list with lines "iBin iEvent seed" (e.g. outliers from the weight log): only these events are
+  // generated and listed in full, with the same arguments as the original job (see regenerate_PythiaAnalysis.sh)
+  std::map<int, std::map<long,long> > regenEvents;
+  bool isRegeneration = getenv("REGENERATE") && !isReplay;
+  if( isRegeneration && !pyHelp.Read_Event_List(getenv("REGENERATE"), regenEvents) )
+    exit(EXIT_FAILURE);
+  bool useEventSeeds = (getenv("EVENTSEEDS") && strcmp(getenv("EVENTSEEDS"),"0") && !isReplay) || isRegeneration;
+  if(useEventSeeds) printf("\nUsing per-event seeds derived from the job seed %ld\n", seed);
+
+  // DEADLINE = seconds (e.g. time limit minus a few minutes for writing): bins are closed early with their real event counts
+  bool useDeadline = pyHelp.Set_Deadline();
+  bool isMB = (!strcmp(argv[2],"MB") || !strcmp(argv[2],"MBVeto")); // only one bin
+
+  // TIMING = 1: time per stage (init, generation, gamma-jet, fills, isolation, scale, write) and pTHat bin in the tree "timing"
+  // PERFCOUNTERS = 1: hardware counters (cycles, instructions, cache and branch misses) per stage and pTHat bin as well
+  bool usePerfCounters = getenv("PERFCOUNTERS") && strcmp(getenv("PERFCOUNTERS"),"0");
+  bool useTiming = (getenv("TIMING") && strcmp(getenv("TIMING"),"0")) || usePerfCounters; // tested at every stage
+  if(useTiming) pyHelp.Enable_Timing();
+  if(usePerfCounters) pyHelp.Enable_Perf_Counters();
+
+  // PROGRESS = interval in seconds (e.g. 300): progress lines with bin, events, rate, accepted fraction, projected end and
+  // memory to progress_<output>.txt, see progress_summary.sh (not in fork-server mode, the report thread must not run at fork())
+  if( getenv("PROGRESS") && forkWorkers ) printf("\nPROGRESS is ignored in fork-server mode\n");
+  else if( getenv("PROGRESS") ){
+    int firstBin = resumeBin >= 0 ? resumeBin : pTHatStartBin;
+    long nEventsTotal = (long)nEvent*(isMB ? 1 : pTHatBins - firstBin) - resumeEvent;
+    if(isReplay){
+      nEventsTotal = 0;
+      for(int iBin = firstBin; iBin < (isMB ? firstBin+1 : pTHatBins); iBin++) nEventsTotal += pyHelp.Get_Replay_Events(iBin);
+    }
+    if(isRegeneration){
+      nEventsTotal = 0;
+      for(std::map<int, std::map<long,long> >::iterator it = regenEvents.begin(); it != regenEvents.end(); ++it) nEventsTotal += it->second.size();
+    }
+    TString progressName = sideFileName;
+    progressName.Insert(progressName.Last('/')+1, "progress_");
+    progressName.Replace(progressName.Last('.'), progressName.Length(), ".txt");
+    if( !pyHelp.Open_Progress(progressName, strtol(getenv("PROGRESS"), NULL, 10), nEventsTotal) )
+      exit(EXIT_FAILURE);
   }
 
   //--- begin pTHat bin loop ----------------------------------
-  for (int iBin = pTHatStartBin; iBin < pTHatBins; ++iBin) {
+  for (int iBin = (resumeBin >= 0 ? resumeBin : pTHatStartBin); iBin < pTHatBins; ++iBin) {
+
+    bool stop = useDeadline && pyHelp.Is_Stop_Requested();
+    if( pyHelp.Get_MPI_Size() > 1 ) stop = pyHelp.Sync_Bin_MPI(iBin, h_weightSum->GetBinContent(1), stop); // all ranks stop together
+    if(stop){
+      printf("no time left for pTHat bins %d - %d, skipping them\n", iBin, pTHatBins-1);
+      break;
+    }
+    if( isRegeneration && !regenEvents.count(iBin) ) continue;
 
+    pyHelp.Start_Timing_Bin(iBin);
+    if(useTiming) pyHelp.Start_Stage(PythiaAnalysisHelper::kInit);
     pyHelp.ProcessSwitch(iBin, pTHatBin, argv, p);
    
-    p.init();
+    if(!isReplay){
+      pyHelp.Set_Stream_Seed(p, iBin);
+      p.init();
+      seed = p.settings.mode("Random:seed");
+    }
+    if(useTiming) pyHelp.Stop_Stage(PythiaAnalysisHelper::kInit);
+    if(useDeadline) pyHelp.Start_Deadline_Bin(isMB ? 1 : pTHatBins - iBin);
+
+    // fork-server mode: the workers generate the events of this bin, the server continues with their summed histograms
+    int iWorker = forkWorkers ? pyHelp.Fork_Workers(p, iBin, forkWorkers) : 0;
+    bool isServer = iWorker < 0;
+    if( forkWorkers && !isServer ) seed = p.settings.mode("Random:seed");
+
+    // resumed bin: continue the random sequence, the events before the checkpoint are in the histograms and the generator info
+    // (without the random state the new seed of this job is used)
+    int firstEvent = 1;
+    if( iBin == resumeBin && resumeEvent > 0 ){
+      pyHelp.Restore_Random_State(p);
+      firstEvent = resumeEvent+1;
+    }
+
+    double sumW2 = 0.; // for the generator info, Pythia only keeps the sum of weights
+    int nEventBin = isReplay ? pyHelp.Get_Replay_Events(iBin) : nEvent;
+    if(isRegeneration) nEventBin = regenEvents[iBin].rbegin()->first;
+    if(isServer) nEventBin = 0;
+    pyHelp.Progress_Bin(iBin, isRegeneration ? (long)regenEvents[iBin].size() : nEventBin-firstEvent+1);
+    PythiaAnalysisHelper::EventInfo info;
 
     //--- begin event loop ----------------------------------------------
-    for (int iEvent = 1; iEvent <= nEvent; ++iEvent) {
-      // Generate event.
-      if (!p.next()) continue;
+    for (int iEvent = firstEvent; iEvent <= nEventBin; ++iEvent) {
+      if( useDeadline && pyHelp.Is_Deadline_Reached() ){
+	printf("pTHat bin %d closed after %d of %d events (deadline)\n", iBin, iEvent-1, nEventBin);
+	break;
+      }
+      if( checkpointInterval > 0 && pyHelp.Get_MPI_Size() == 1 && time(0) - lastCheckpoint >= checkpointInterval ){
+	pyHelp.Write_Checkpoint(p, checkpointName, runID, iBin, iEvent-1, vec_weightSum_genInfo_bin.at(iBin), sumW2);
+	lastCheckpoint = time(0);
+      }
 
-      // boost if pPb
-      if( applyBoost ) p.event.bst(0., 0., boostBetaZ);
+      long eventSeed = 0; // 0 = no per-event seed (EVENTSEEDS off), the event cannot be regenerated
+      if(isRegeneration){
+	if( !regenEvents[iBin].count(iEvent) ) continue;
+	eventSeed = regenEvents[iBin][iEvent];
+      }
+      else if(useEventSeeds) eventSeed = pyHelp.Get_Event_Seed(seed, iBin, iEvent);
+
+      // Generate event (or rebuild it from the event store).
+      if(isReplay){
+	PythiaAnalysisHelper::Stage_Timer timer(pyHelp, PythiaAnalysisHelper::kGeneration, useTiming);
+	if( !pyHelp.Next_Replay_Event(p.event, info, iBin) ) break;
+      }else{
+	PythiaAnalysisHelper::Stage_Timer timer(pyHelp, PythiaAnalysisHelper::kGeneration, useTiming);
+	if(useEventSeeds) pyHelp.Reseed_Event(p, eventSeed);
+	if (!p.next()) continue;
+	pyHelp.Get_Event_Info(p, info);
+      }
+      if(isRegeneration){
+	printf("\n--- regenerated event %d of pTHat bin %d (seed %ld): pTHat = %f, weight = %e ---\n", iEvent, iBin, eventSeed, info.pTHat, info.weights.at(0));
+	p.info.list();
+	p.process.list();
+	p.event.list();
+      }
+      sumW2 += info.weights.at(0)*info.weights.at(0);
+      pyHelp.Count_Event();
+      pyHelp.Progress_Event();
+
+      // boost if pPb (stored events are boosted already)
+      if( applyBoost && !isReplay ) p.event.bst(0., 0., boostBetaZ);
+      bool isVetoed = !strcmp(argv[2],"MBVeto") && MB_veto && info.pTHat > pTHatBin[iBin];
+      if(useWeightLog) pyHelp.Log_Event_Weights(iEvent, iBin, info.pTHat, 0., pyHelp.Get_Leading_Direct_Photon_Pt(p.event, etaAccMax), info.weights, eventSeed, isVetoed);
       if(iEvent == 1)
         cout << "energy of beam a = " << p.event[1].e() << endl
              << "energy of beam b = " << p.event[2].e() << endl;
 
       if ( !strcmp(argv[2],"MBVeto") && MB_veto ) {	//---------------------------------------------------------
 	// reject softQCD events in the hardQCD regime
-	if (p.info.pTHat() > pTHatBin[iBin]) continue;
+	if (isVetoed){
+	  pyHelp.Progress_Veto();
+	  continue;
+	}
 	
 	// #### omitted (at least for the moment) because it may change cross section ###########
 	/*	// reject softQCD events with super large weight, i.e. pthat << ptparticle
@@ -1152,7 +1146,7 @@ int main(int argc, char **argv) {
 	
       }	//------------------------------------------------------------------------------------------
 
-
+      if(useEventStore) pyHelp.Store_Event(p.event, info, iBin);
 
       
       //------------------------------------------------------------------------------------------
@@ -1163,6 +1157,7 @@ int main(int argc, char **argv) {
       std::vector<PseudoJet> vPseudo;
       ClusterSequence *cs = 0;
       if(useGammaJetCorrelations){
+	PythiaAnalysisHelper::Stage_Timer timer(pyHelp, PythiaAnalysisHelper::kGammaJet, useTiming);
 	for (int i = 5; i < p.event.size(); i++) {
 	  if (p.event[i].isFinal() && p.event[i].isCharged()) {
 	    if (TMath::Abs(p.event[i].eta()) < etaTPC){
@@ -1234,12 +1229,12 @@ int main(int argc, char **argv) {
 		// charged particle multiplicity in jets
 		vec_chJetTrackMult_bin.at(iBin)->Fill(vec_jetConst.size());
 		// x_obs p-going direction
-		vec_xObs_pGoing_bin.at(iBin)->Fill(pyHelp.XObs_pGoing(vJets.at(iJet), photonJet, p.info.eB()));
+		vec_xObs_pGoing_bin.at(iBin)->Fill(pyHelp.XObs_pGoing(vJets.at(iJet), photonJet, info.eB));
 		// x_obs Pb-going direction
-		vec_xObs_PbGoing_bin.at(iBin)->Fill(pyHelp.XObs_PbGoing(vJets.at(iJet), photonJet, p.info.eB()));
+		vec_xObs_PbGoing_bin.at(iBin)->Fill(pyHelp.XObs_PbGoing(vJets.at(iJet), photonJet, info.eB));
 		// real Bjorken x
-		vec_xBjorken_1_bin.at(iBin)->Fill(p.info.x1());
-		vec_xBjorken_2_bin.at(iBin)->Fill(p.info.x2());
+		vec_xBjorken_1_bin.at(iBin)->Fill(info.x1);
+		vec_xBjorken_2_bin.at(iBin)->Fill(info.x2);
 	      }
 
 	    // print scales of event
@@ -1260,111 +1255,60 @@ int main(int argc, char **argv) {
       //------------------------------------------------------------------------------------------
 
       //------------------------------------------------------------------------------------------
+      if(useTiming) pyHelp.Start_Stage(PythiaAnalysisHelper::kFills);
       pyHelp.Fill_TH2_Electron_TopMotherID(p.event, etaEMCal, vec_electron_pt_topMotherID_bin.at(iBin));
 
-      pyHelp.Fill_Electron_Pt(p.event, yDefault, true, vec_electron_yDefault_bin.at(iBin));
-      pyHelp.Fill_Electron_Pt(p.event, etaLarge, false, vec_electron_etaLarge_bin.at(iBin));
-      pyHelp.Fill_Electron_Pt(p.event, etaTPC, false, vec_electron_etaTPC_bin.at(iBin));
-      pyHelp.Fill_Electron_Pt(p.event, etaEMCal, false, vec_electron_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_Electron_Pt(p.event, etaPHOS, false, vec_electron_etaPHOS_bin.at(iBin));
+      pyHelp.Fill_Electron_EtaPt(p.event, yDefault, true, vec_electron_yPt_bin.at(iBin));
+      pyHelp.Fill_Electron_EtaPt(p.event, etaAccMax, false, vec_electron_etaPt_bin.at(iBin));
       
-      pyHelp.Fill_Pi0_Pt(p.event, yDefault, true, vec_pi0_yDefault_bin.at(iBin));
-      pyHelp.Fill_Pi0_Pt(p.event, etaLarge, false, vec_pi0_etaLarge_bin.at(iBin));
-      pyHelp.Fill_Pi0_Pt(p.event, etaTPC, false, vec_pi0_etaTPC_bin.at(iBin));
-      pyHelp.Fill_Pi0_Pt(p.event, etaEMCal, false, vec_pi0_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_Pi0_Pt(p.event, etaPHOS, false, vec_pi0_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_Pi0Primary_Pt(p.event, yDefault, true, vec_pi0primary_yDefault_bin.at(iBin));
-      pyHelp.Fill_Pi0Primary_Pt(p.event, etaLarge, false, vec_pi0primary_etaLarge_bin.at(iBin));
-      pyHelp.Fill_Pi0Primary_Pt(p.event, etaTPC, false, vec_pi0primary_etaTPC_bin.at(iBin));
-      pyHelp.Fill_Pi0Primary_Pt(p.event, etaEMCal, false, vec_pi0primary_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_Pi0Primary_Pt(p.event, etaPHOS, false, vec_pi0primary_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_Eta_Pt(p.event, yDefault, true, vec_eta_yDefault_bin.at(iBin));
-      pyHelp.Fill_Eta_Pt(p.event, etaLarge, false, vec_eta_etaLarge_bin.at(iBin));
-      pyHelp.Fill_Eta_Pt(p.event, etaTPC, false, vec_eta_etaTPC_bin.at(iBin));
-      pyHelp.Fill_Eta_Pt(p.event, etaEMCal, false, vec_eta_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_Eta_Pt(p.event, etaPHOS, false, vec_eta_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_EtaPrime_Pt(p.event, yDefault, true, vec_etaprime_yDefault_bin.at(iBin));
-      pyHelp.Fill_EtaPrime_Pt(p.event, etaLarge, false, vec_etaprime_etaLarge_bin.at(iBin));
-      pyHelp.Fill_EtaPrime_Pt(p.event, etaTPC, false, vec_etaprime_etaTPC_bin.at(iBin));
-      pyHelp.Fill_EtaPrime_Pt(p.event, etaEMCal, false, vec_etaprime_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_EtaPrime_Pt(p.event, etaPHOS, false, vec_etaprime_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_Omega_Pt(p.event, yDefault, true, vec_omega_yDefault_bin.at(iBin));
-      pyHelp.Fill_Omega_Pt(p.event, etaLarge, false, vec_omega_etaLarge_bin.at(iBin));
-      pyHelp.Fill_Omega_Pt(p.event, etaTPC, false, vec_omega_etaTPC_bin.at(iBin));
-      pyHelp.Fill_Omega_Pt(p.event, etaEMCal, false, vec_omega_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_Omega_Pt(p.event, etaPHOS, false, vec_omega_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_Direct_Photon_Pt(p.event, yDefault, vec_direct_photons_yDefault_bin.at(iBin));
-      pyHelp.Fill_Direct_Photon_Pt(p.event, etaLarge, vec_direct_photons_etaLarge_bin.at(iBin));
-      pyHelp.Fill_Direct_Photon_Pt(p.event, etaTPC, vec_direct_photons_etaTPC_bin.at(iBin));
-      pyHelp.Fill_Direct_Photon_Pt(p.event, etaEMCal, vec_direct_photons_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_Direct_Photon_Pt(p.event, etaPHOS, vec_direct_photons_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_Shower_Photon_Pt(p.event, yDefault, vec_shower_photons_yDefault_bin.at(iBin));
-      pyHelp.Fill_Shower_Photon_Pt(p.event, etaLarge, vec_shower_photons_etaLarge_bin.at(iBin));
-      pyHelp.Fill_Shower_Photon_Pt(p.event, etaTPC, vec_shower_photons_etaTPC_bin.at(iBin));
-      pyHelp.Fill_Shower_Photon_Pt(p.event, etaEMCal, vec_shower_photons_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_Shower_Photon_Pt(p.event, etaPHOS, vec_shower_photons_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_222_Photon_Pt(p.event, yDefault, vec_222_photons_yDefault_bin.at(iBin));
-      pyHelp.Fill_222_Photon_Pt(p.event, etaLarge, vec_222_photons_etaLarge_bin.at(iBin));
-      pyHelp.Fill_222_Photon_Pt(p.event, etaTPC, vec_222_photons_etaTPC_bin.at(iBin));
-      pyHelp.Fill_222_Photon_Pt(p.event, etaEMCal, vec_222_photons_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_222_Photon_Pt(p.event, etaPHOS, vec_222_photons_etaPHOS_bin.at(iBin));
+      pyHelp.Fill_Pi0_EtaPt(p.event, yDefault, true, vec_pi0_yPt_bin.at(iBin));
+      pyHelp.Fill_Pi0_EtaPt(p.event, etaAccMax, false, vec_pi0_etaPt_bin.at(iBin));
+
+      pyHelp.Fill_Pi0Primary_EtaPt(p.event, yDefault, true, vec_pi0primary_yPt_bin.at(iBin));
+      pyHelp.Fill_Pi0Primary_EtaPt(p.event, etaAccMax, false, vec_pi0primary_etaPt_bin.at(iBin));
+
+      pyHelp.Fill_Eta_EtaPt(p.event, yDefault, true, vec_eta_yPt_bin.at(iBin));
+      pyHelp.Fill_Eta_EtaPt(p.event, etaAccMax, false, vec_eta_etaPt_bin.at(iBin));
+
+      pyHelp.Fill_EtaPrime_EtaPt(p.event, yDefault, true, vec_etaprime_yPt_bin.at(iBin));
+      pyHelp.Fill_EtaPrime_EtaPt(p.event, etaAccMax, false, vec_etaprime_etaPt_bin.at(iBin));
+
+      pyHelp.Fill_Omega_EtaPt(p.event, yDefault, true, vec_omega_yPt_bin.at(iBin));
+      pyHelp.Fill_Omega_EtaPt(p.event, etaAccMax, false, vec_omega_etaPt_bin.at(iBin));
+
+      pyHelp.Fill_Direct_Photon_EtaPt(p.event, yDefault, true, vec_direct_photons_yPt_bin.at(iBin));
+      pyHelp.Fill_Direct_Photon_EtaPt(p.event, etaAccMax, false, vec_direct_photons_etaPt_bin.at(iBin));
+
+      pyHelp.Fill_Shower_Photon_EtaPt(p.event, yDefault, true, vec_shower_photons_yPt_bin.at(iBin));
+      pyHelp.Fill_Shower_Photon_EtaPt(p.event, etaAccMax, false, vec_shower_photons_etaPt_bin.at(iBin));
+
+      pyHelp.Fill_222_Photon_EtaPt(p.event, yDefault, true, vec_222_photons_yPt_bin.at(iBin));
+      pyHelp.Fill_222_Photon_EtaPt(p.event, etaAccMax, false, vec_222_photons_etaPt_bin.at(iBin));
       
-      pyHelp.Fill_Decay_Photon_Pt(p.event, yDefault, vec_decay_photons_yDefault_bin.at(iBin));
-      pyHelp.Fill_Decay_Photon_Pt(p.event, etaLarge, vec_decay_photons_etaLarge_bin.at(iBin));
-      pyHelp.Fill_Decay_Photon_Pt(p.event, etaTPC, vec_decay_photons_etaTPC_bin.at(iBin));
-      pyHelp.Fill_Decay_Photon_Pt(p.event, etaEMCal, vec_decay_photons_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_Decay_Photon_Pt(p.event, etaPHOS, vec_decay_photons_etaPHOS_bin.at(iBin));
+      pyHelp.Fill_Decay_Photon_EtaPt(p.event, yDefault, true, vec_decay_photons_yPt_bin.at(iBin));
+      pyHelp.Fill_Decay_Photon_EtaPt(p.event, etaAccMax, false, vec_decay_photons_etaPt_bin.at(iBin));
+      if(useTiming) pyHelp.Stop_Stage(PythiaAnalysisHelper::kFills);
 
       if(producePhotonIsoSpectra){
+	PythiaAnalysisHelper::Stage_Timer timer(pyHelp, PythiaAnalysisHelper::kIsolation, useTiming);
 	// fill isolated photons: considers only direct photons
 	// arguments = (p.event, etaAcc, vec_histo, bool onlyCharged?, iso cone radius, iso pt)
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_charged2GeV_R03_photons_etaTPC_bin.at(iBin), true, 0.3, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_charged2GeV_R04_photons_etaTPC_bin.at(iBin), true, 0.4, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_charged2GeV_R05_photons_etaTPC_bin.at(iBin), true, 0.5, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_charged2GeV_R03_photons_etaEMCal_bin.at(iBin), true, 0.3, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_charged2GeV_R04_photons_etaEMCal_bin.at(iBin), true, 0.4, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_charged2GeV_R05_photons_etaEMCal_bin.at(iBin), true, 0.5, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_charged2GeV_R03_photons_etaPHOS_bin.at(iBin), true, 0.3, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_charged2GeV_R04_photons_etaPHOS_bin.at(iBin), true, 0.4, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_charged2GeV_R05_photons_etaPHOS_bin.at(iBin), true, 0.5, 2.);
-
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_charged3GeV_R03_photons_etaTPC_bin.at(iBin), true, 0.3, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_charged3GeV_R04_photons_etaTPC_bin.at(iBin), true, 0.4, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_charged3GeV_R05_photons_etaTPC_bin.at(iBin), true, 0.5, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_charged3GeV_R03_photons_etaEMCal_bin.at(iBin), true, 0.3, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_charged3GeV_R04_photons_etaEMCal_bin.at(iBin), true, 0.4, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_charged3GeV_R05_photons_etaEMCal_bin.at(iBin), true, 0.5, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_charged3GeV_R03_photons_etaPHOS_bin.at(iBin), true, 0.3, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_charged3GeV_R04_photons_etaPHOS_bin.at(iBin), true, 0.4, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_charged3GeV_R05_photons_etaPHOS_bin.at(iBin), true, 0.5, 3.);
-
-
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_full2GeV_R03_photons_etaTPC_bin.at(iBin), false, 0.3, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_full2GeV_R04_photons_etaTPC_bin.at(iBin), false, 0.4, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_full2GeV_R05_photons_etaTPC_bin.at(iBin), false, 0.5, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_full2GeV_R03_photons_etaEMCal_bin.at(iBin), false, 0.3, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_full2GeV_R04_photons_etaEMCal_bin.at(iBin), false, 0.4, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_full2GeV_R05_photons_etaEMCal_bin.at(iBin), false, 0.5, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_full2GeV_R03_photons_etaPHOS_bin.at(iBin), false, 0.3, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_full2GeV_R04_photons_etaPHOS_bin.at(iBin), false, 0.4, 2.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_full2GeV_R05_photons_etaPHOS_bin.at(iBin), false, 0.5, 2.);
-
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_full3GeV_R03_photons_etaTPC_bin.at(iBin), false, 0.3, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_full3GeV_R04_photons_etaTPC_bin.at(iBin), false, 0.4, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_iso_full3GeV_R05_photons_etaTPC_bin.at(iBin), false, 0.5, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_full3GeV_R03_photons_etaEMCal_bin.at(iBin), false, 0.3, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_full3GeV_R04_photons_etaEMCal_bin.at(iBin), false, 0.4, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_iso_full3GeV_R05_photons_etaEMCal_bin.at(iBin), false, 0.5, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_full3GeV_R03_photons_etaPHOS_bin.at(iBin), false, 0.3, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_full3GeV_R04_photons_etaPHOS_bin.at(iBin), false, 0.4, 3.);
-	pyHelp.Fill_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_iso_full3GeV_R05_photons_etaPHOS_bin.at(iBin), false, 0.5, 3.);
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_charged2GeV_R03_photons_etaPt_bin.at(iBin), true, 0.3, 2.);
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_charged2GeV_R04_photons_etaPt_bin.at(iBin), true, 0.4, 2.);
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_charged2GeV_R05_photons_etaPt_bin.at(iBin), true, 0.5, 2.);
+
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_charged3GeV_R03_photons_etaPt_bin.at(iBin), true, 0.3, 3.);
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_charged3GeV_R04_photons_etaPt_bin.at(iBin), true, 0.4, 3.);
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_charged3GeV_R05_photons_etaPt_bin.at(iBin), true, 0.5, 3.);
+
+
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_full2GeV_R03_photons_etaPt_bin.at(iBin), false, 0.3, 2.);
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_full2GeV_R04_photons_etaPt_bin.at(iBin), false, 0.4, 2.);
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_full2GeV_R05_photons_etaPt_bin.at(iBin), false, 0.5, 2.);
+
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_full3GeV_R03_photons_etaPt_bin.at(iBin), false, 0.3, 3.);
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_full3GeV_R04_photons_etaPt_bin.at(iBin), false, 0.4, 3.);
+	pyHelp.Fill_Direct_Iso_Photon_EtaPt(p.event, etaTPC, vec_iso_full3GeV_R05_photons_etaPt_bin.at(iBin), false, 0.5, 3.);
 
 
   //
@@ -1438,126 +1382,31 @@ int main(int argc, char **argv) {
   pyHelp.Fill_iso_All_Photon_Pt(p.event, etaPHOS, vec_iso_full_R05_all_photons_etaPHOS_bin.at(iBin), false, 0.5, 2.);
       }
 
-      //----------------------------------------------------------------------------------------------------
-      // do the same jazz for invariant cross section histos ------------------------------------------
-      //------------------------------------------------------------------------------------------
-
-      pyHelp.Fill_invXsec_Pi0_Pt(p.event, yDefault, true, vec_invXsec_pi0_yDefault_bin.at(iBin));
-      pyHelp.Fill_invXsec_Pi0_Pt(p.event, etaLarge, false, vec_invXsec_pi0_etaLarge_bin.at(iBin));
-      pyHelp.Fill_invXsec_Pi0_Pt(p.event, etaTPC, false, vec_invXsec_pi0_etaTPC_bin.at(iBin));
-      pyHelp.Fill_invXsec_Pi0_Pt(p.event, etaEMCal, false, vec_invXsec_pi0_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_invXsec_Pi0_Pt(p.event, etaPHOS, false, vec_invXsec_pi0_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_invXsec_Pi0Primary_Pt(p.event, yDefault, true, vec_invXsec_pi0primary_yDefault_bin.at(iBin));
-      pyHelp.Fill_invXsec_Pi0Primary_Pt(p.event, etaLarge, false, vec_invXsec_pi0primary_etaLarge_bin.at(iBin));
-      pyHelp.Fill_invXsec_Pi0Primary_Pt(p.event, etaTPC, false, vec_invXsec_pi0primary_etaTPC_bin.at(iBin));
-      pyHelp.Fill_invXsec_Pi0Primary_Pt(p.event, etaEMCal, false, vec_invXsec_pi0primary_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_invXsec_Pi0Primary_Pt(p.event, etaPHOS, false, vec_invXsec_pi0primary_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_invXsec_Eta_Pt(p.event, yDefault, true, vec_invXsec_eta_yDefault_bin.at(iBin));
-      pyHelp.Fill_invXsec_Eta_Pt(p.event, etaLarge, false, vec_invXsec_eta_etaLarge_bin.at(iBin));
-      pyHelp.Fill_invXsec_Eta_Pt(p.event, etaTPC, false, vec_invXsec_eta_etaTPC_bin.at(iBin));
-      pyHelp.Fill_invXsec_Eta_Pt(p.event, etaEMCal, false, vec_invXsec_eta_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_invXsec_Eta_Pt(p.event, etaPHOS, false, vec_invXsec_eta_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_invXsec_EtaPrime_Pt(p.event, yDefault, true, vec_invXsec_etaprime_yDefault_bin.at(iBin));
-      pyHelp.Fill_invXsec_EtaPrime_Pt(p.event, etaLarge, false, vec_invXsec_etaprime_etaLarge_bin.at(iBin));
-      pyHelp.Fill_invXsec_EtaPrime_Pt(p.event, etaTPC, false, vec_invXsec_etaprime_etaTPC_bin.at(iBin));
-      pyHelp.Fill_invXsec_EtaPrime_Pt(p.event, etaEMCal, false, vec_invXsec_etaprime_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_invXsec_EtaPrime_Pt(p.event, etaPHOS, false, vec_invXsec_etaprime_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_invXsec_Omega_Pt(p.event, yDefault, true, vec_invXsec_omega_yDefault_bin.at(iBin));
-      pyHelp.Fill_invXsec_Omega_Pt(p.event, etaLarge, false, vec_invXsec_omega_etaLarge_bin.at(iBin));
-      pyHelp.Fill_invXsec_Omega_Pt(p.event, etaTPC, false, vec_invXsec_omega_etaTPC_bin.at(iBin));
-      pyHelp.Fill_invXsec_Omega_Pt(p.event, etaEMCal, false, vec_invXsec_omega_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_invXsec_Omega_Pt(p.event, etaPHOS, false, vec_invXsec_omega_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_invXsec_Direct_Photon_Pt(p.event, yDefault, vec_invXsec_direct_photons_yDefault_bin.at(iBin));
-      pyHelp.Fill_invXsec_Direct_Photon_Pt(p.event, etaLarge, vec_invXsec_direct_photons_etaLarge_bin.at(iBin));
-      pyHelp.Fill_invXsec_Direct_Photon_Pt(p.event, etaTPC, vec_invXsec_direct_photons_etaTPC_bin.at(iBin));
-      pyHelp.Fill_invXsec_Direct_Photon_Pt(p.event, etaEMCal, vec_invXsec_direct_photons_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_invXsec_Direct_Photon_Pt(p.event, etaPHOS, vec_invXsec_direct_photons_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_invXsec_Shower_Photon_Pt(p.event, yDefault, vec_invXsec_shower_photons_yDefault_bin.at(iBin));
-      pyHelp.Fill_invXsec_Shower_Photon_Pt(p.event, etaLarge, vec_invXsec_shower_photons_etaLarge_bin.at(iBin));
-      pyHelp.Fill_invXsec_Shower_Photon_Pt(p.event, etaTPC, vec_invXsec_shower_photons_etaTPC_bin.at(iBin));
-      pyHelp.Fill_invXsec_Shower_Photon_Pt(p.event, etaEMCal, vec_invXsec_shower_photons_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_invXsec_Shower_Photon_Pt(p.event, etaPHOS, vec_invXsec_shower_photons_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_invXsec_222_Photon_Pt(p.event, yDefault, vec_invXsec_222_photons_yDefault_bin.at(iBin));
-      pyHelp.Fill_invXsec_222_Photon_Pt(p.event, etaLarge, vec_invXsec_222_photons_etaLarge_bin.at(iBin));
-      pyHelp.Fill_invXsec_222_Photon_Pt(p.event, etaTPC, vec_invXsec_222_photons_etaTPC_bin.at(iBin));
-      pyHelp.Fill_invXsec_222_Photon_Pt(p.event, etaEMCal, vec_invXsec_222_photons_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_invXsec_222_Photon_Pt(p.event, etaPHOS, vec_invXsec_222_photons_etaPHOS_bin.at(iBin));
-
-      pyHelp.Fill_invXsec_Decay_Photon_Pt(p.event, yDefault, vec_invXsec_decay_photons_yDefault_bin.at(iBin));
-      pyHelp.Fill_invXsec_Decay_Photon_Pt(p.event, etaLarge, vec_invXsec_decay_photons_etaLarge_bin.at(iBin));
-      pyHelp.Fill_invXsec_Decay_Photon_Pt(p.event, etaTPC, vec_invXsec_decay_photons_etaTPC_bin.at(iBin));
-      pyHelp.Fill_invXsec_Decay_Photon_Pt(p.event, etaEMCal, vec_invXsec_decay_photons_etaEMCal_bin.at(iBin));
-      pyHelp.Fill_invXsec_Decay_Photon_Pt(p.event, etaPHOS, vec_invXsec_decay_photons_etaPHOS_bin.at(iBin));
-
-      if(producePhotonIsoSpectra){
-	// fill isolated photons: considers only direct photons
-	// arguments = (p.event, etaAcc, vec_invXsec_histo, bool onlyCharged?, iso cone radius, iso pt)
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_charged2GeV_R03_photons_etaTPC_bin.at(iBin), true, 0.3, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_charged2GeV_R04_photons_etaTPC_bin.at(iBin), true, 0.4, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_charged2GeV_R05_photons_etaTPC_bin.at(iBin), true, 0.5, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_charged2GeV_R03_photons_etaEMCal_bin.at(iBin), true, 0.3, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_charged2GeV_R04_photons_etaEMCal_bin.at(iBin), true, 0.4, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_charged2GeV_R05_photons_etaEMCal_bin.at(iBin), true, 0.5, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_charged2GeV_R03_photons_etaPHOS_bin.at(iBin), true, 0.3, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_charged2GeV_R04_photons_etaPHOS_bin.at(iBin), true, 0.4, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_charged2GeV_R05_photons_etaPHOS_bin.at(iBin), true, 0.5, 2.);
-
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_charged3GeV_R03_photons_etaTPC_bin.at(iBin), true, 0.3, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_charged3GeV_R04_photons_etaTPC_bin.at(iBin), true, 0.4, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_charged3GeV_R05_photons_etaTPC_bin.at(iBin), true, 0.5, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_charged3GeV_R03_photons_etaEMCal_bin.at(iBin), true, 0.3, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_charged3GeV_R04_photons_etaEMCal_bin.at(iBin), true, 0.4, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_charged3GeV_R05_photons_etaEMCal_bin.at(iBin), true, 0.5, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_charged3GeV_R03_photons_etaPHOS_bin.at(iBin), true, 0.3, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_charged3GeV_R04_photons_etaPHOS_bin.at(iBin), true, 0.4, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_charged3GeV_R05_photons_etaPHOS_bin.at(iBin), true, 0.5, 3.);
-
-
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_full2GeV_R03_photons_etaTPC_bin.at(iBin), false, 0.3, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_full2GeV_R04_photons_etaTPC_bin.at(iBin), false, 0.4, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_full2GeV_R05_photons_etaTPC_bin.at(iBin), false, 0.5, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_full2GeV_R03_photons_etaEMCal_bin.at(iBin), false, 0.3, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_full2GeV_R04_photons_etaEMCal_bin.at(iBin), false, 0.4, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_full2GeV_R05_photons_etaEMCal_bin.at(iBin), false, 0.5, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_full2GeV_R03_photons_etaPHOS_bin.at(iBin), false, 0.3, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_full2GeV_R04_photons_etaPHOS_bin.at(iBin), false, 0.4, 2.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_full2GeV_R05_photons_etaPHOS_bin.at(iBin), false, 0.5, 2.);
-
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_full3GeV_R03_photons_etaTPC_bin.at(iBin), false, 0.3, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_full3GeV_R04_photons_etaTPC_bin.at(iBin), false, 0.4, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaTPC, vec_invXsec_iso_full3GeV_R05_photons_etaTPC_bin.at(iBin), false, 0.5, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_full3GeV_R03_photons_etaEMCal_bin.at(iBin), false, 0.3, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_full3GeV_R04_photons_etaEMCal_bin.at(iBin), false, 0.4, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaEMCal, vec_invXsec_iso_full3GeV_R05_photons_etaEMCal_bin.at(iBin), false, 0.5, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_full3GeV_R03_photons_etaPHOS_bin.at(iBin), false, 0.3, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_full3GeV_R04_photons_etaPHOS_bin.at(iBin), false, 0.4, 3.);
-	pyHelp.Fill_invXsec_Direct_Iso_Photon_Pt(p.event, etaPHOS, vec_invXsec_iso_full3GeV_R05_photons_etaPHOS_bin.at(iBin), false, 0.5, 3.);
-      }
-      
 
       //----------------------------------------------------------------------------------------------------
-      vec_pTHat_bin.at(iBin)->Fill(p.info.pTHat());
+      vec_pTHat_bin.at(iBin)->Fill(info.pTHat);
 
     }// end of event loop
 
-    p.stat();
-
-    double sigma = p.info.sigmaGen()*1e9; // cross section in picobarn
+    // sigma and weightSum from the generator info, i.e. incl. the segments before a resumed checkpoint
+    // (replay: the stored generator info for the fraction of events in this chunk)
+    if(isReplay) pyHelp.Get_Replay_Generator_Info(iBin, vec_weightSum_genInfo_bin.at(iBin));
+    else if(!isServer){
+      p.stat();
+      pyHelp.Fill_Generator_Info(vec_weightSum_genInfo_bin.at(iBin), p.info, sumW2);
+      if(forkWorkers) pyHelp.Return_To_Server(); // the worker ends here
+    }
+    double sigma = pyHelp.Get_SigmaGen(vec_weightSum_genInfo_bin.at(iBin)); // cross section in picobarn
+    double weightSum = vec_weightSum_genInfo_bin.at(iBin)->GetBinContent(1);
     //    double sigma_per_event = sigma/p.info.weightSum(); // weightSum = number of events in standard Pythia8
     cout << "sigma = " << sigma << endl;
-    cout << "weightSum = " << p.info.weightSum() << endl;
+    cout << "weightSum = " << weightSum << endl;
 
-    vec_weightSum_bin.at(iBin)->SetBinContent(1,p.info.weightSum());
-    h_weightSum->SetBinContent(1,h_weightSum->GetBinContent(1)+p.info.weightSum());
-    cout << "- - - weightSum() = " << p.info.weightSum() << endl;
+    vec_weightSum_bin.at(iBin)->SetBinContent(1,weightSum);
+    h_weightSum->SetBinContent(1,h_weightSum->GetBinContent(1)+weightSum);
+    cout << "- - - weightSum() = " << weightSum << endl;
 
+    if(useTiming) pyHelp.Start_Stage(PythiaAnalysisHelper::kScale);
     vec_chJets_pt_etaTPC_bin.at(iBin)->Scale(sigma);
     vec_chJets_pt_leading_etaTPC_bin.at(iBin)->Scale(sigma);
     
@@ -1579,106 +1428,52 @@ int main(int argc, char **argv) {
     
     vec_electron_pt_topMotherID_bin.at(iBin)->Scale(sigma);
 
-    vec_electron_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_electron_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_electron_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_electron_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_electron_etaPHOS_bin.at(iBin)->Scale(sigma);
+    vec_electron_yPt_bin.at(iBin)->Scale(sigma);
+    vec_electron_etaPt_bin.at(iBin)->Scale(sigma);
   
-    vec_pi0_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_pi0_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_pi0_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_pi0_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_pi0_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_pi0primary_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_pi0primary_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_pi0primary_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_pi0primary_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_pi0primary_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_eta_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_eta_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_eta_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_eta_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_eta_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_etaprime_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_etaprime_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_etaprime_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_etaprime_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_etaprime_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_omega_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_omega_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_omega_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_omega_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_omega_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_direct_photons_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_direct_photons_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_direct_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_direct_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_direct_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_shower_photons_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_shower_photons_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_shower_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_shower_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_shower_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_222_photons_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_222_photons_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_222_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_222_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_222_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_decay_photons_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_decay_photons_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_decay_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_decay_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_decay_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
+    vec_pi0_yPt_bin.at(iBin)->Scale(sigma);
+    vec_pi0_etaPt_bin.at(iBin)->Scale(sigma);
+
+    vec_pi0primary_yPt_bin.at(iBin)->Scale(sigma);
+    vec_pi0primary_etaPt_bin.at(iBin)->Scale(sigma);
+
+    vec_eta_yPt_bin.at(iBin)->Scale(sigma);
+    vec_eta_etaPt_bin.at(iBin)->Scale(sigma);
+
+    vec_etaprime_yPt_bin.at(iBin)->Scale(sigma);
+    vec_etaprime_etaPt_bin.at(iBin)->Scale(sigma);
+
+    vec_omega_yPt_bin.at(iBin)->Scale(sigma);
+    vec_omega_etaPt_bin.at(iBin)->Scale(sigma);
+
+    vec_direct_photons_yPt_bin.at(iBin)->Scale(sigma);
+    vec_direct_photons_etaPt_bin.at(iBin)->Scale(sigma);
+
+    vec_shower_photons_yPt_bin.at(iBin)->Scale(sigma);
+    vec_shower_photons_etaPt_bin.at(iBin)->Scale(sigma);
+
+    vec_222_photons_yPt_bin.at(iBin)->Scale(sigma);
+    vec_222_photons_etaPt_bin.at(iBin)->Scale(sigma);
+
+    vec_decay_photons_yPt_bin.at(iBin)->Scale(sigma);
+    vec_decay_photons_etaPt_bin.at(iBin)->Scale(sigma);
 
     if(producePhotonIsoSpectra){
-      vec_iso_charged2GeV_R03_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged2GeV_R04_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged2GeV_R05_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged2GeV_R03_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged2GeV_R04_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged2GeV_R05_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged2GeV_R03_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged2GeV_R04_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged2GeV_R05_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-      vec_iso_charged3GeV_R03_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged3GeV_R04_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged3GeV_R05_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged3GeV_R03_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged3GeV_R04_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged3GeV_R05_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged3GeV_R03_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged3GeV_R04_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_iso_charged3GeV_R05_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-      vec_iso_full2GeV_R03_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_full2GeV_R04_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_full2GeV_R05_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_full2GeV_R03_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_full2GeV_R04_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_full2GeV_R05_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_full2GeV_R03_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_iso_full2GeV_R04_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_iso_full2GeV_R05_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-      vec_iso_full3GeV_R03_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_full3GeV_R04_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_full3GeV_R05_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_iso_full3GeV_R03_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_full3GeV_R04_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_full3GeV_R05_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_iso_full3GeV_R03_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_iso_full3GeV_R04_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_iso_full3GeV_R05_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
+      vec_iso_charged2GeV_R03_photons_etaPt_bin.at(iBin)->Scale(sigma);
+      vec_iso_charged2GeV_R04_photons_etaPt_bin.at(iBin)->Scale(sigma);
+      vec_iso_charged2GeV_R05_photons_etaPt_bin.at(iBin)->Scale(sigma);
+
+      vec_iso_charged3GeV_R03_photons_etaPt_bin.at(iBin)->Scale(sigma);
+      vec_iso_charged3GeV_R04_photons_etaPt_bin.at(iBin)->Scale(sigma);
+      vec_iso_charged3GeV_R05_photons_etaPt_bin.at(iBin)->Scale(sigma);
+
+      vec_iso_full2GeV_R03_photons_etaPt_bin.at(iBin)->Scale(sigma);
+      vec_iso_full2GeV_R04_photons_etaPt_bin.at(iBin)->Scale(sigma);
+      vec_iso_full2GeV_R05_photons_etaPt_bin.at(iBin)->Scale(sigma);
+
+      vec_iso_full3GeV_R03_photons_etaPt_bin.at(iBin)->Scale(sigma);
+      vec_iso_full3GeV_R04_photons_etaPt_bin.at(iBin)->Scale(sigma);
+      vec_iso_full3GeV_R05_photons_etaPt_bin.at(iBin)->Scale(sigma);
 
       //
       // ─── PT IN CONE ──────────────────────────────────────────────────
@@ -1751,106 +1546,17 @@ int main(int argc, char **argv) {
     //----------------------------------------------------------------------------------------------------
     // do the same jazz for invariant cross section histos ------------------------------------------
     //------------------------------------------------------------------------------------------
-
-    vec_invXsec_pi0_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_pi0_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_pi0_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_pi0_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_pi0_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_invXsec_pi0primary_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_pi0primary_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_pi0primary_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_pi0primary_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_pi0primary_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_invXsec_eta_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_eta_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_eta_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_eta_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_eta_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_invXsec_etaprime_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_etaprime_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_etaprime_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_etaprime_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_etaprime_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_invXsec_omega_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_omega_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_omega_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_omega_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_omega_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_invXsec_direct_photons_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_direct_photons_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_direct_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_direct_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_direct_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_invXsec_shower_photons_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_shower_photons_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_shower_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_shower_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_shower_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_invXsec_222_photons_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_222_photons_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_222_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_222_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_222_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-    vec_invXsec_decay_photons_yDefault_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_decay_photons_etaLarge_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_decay_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_decay_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-    vec_invXsec_decay_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-
-    if(producePhotonIsoSpectra){
-      vec_invXsec_iso_charged2GeV_R03_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged2GeV_R04_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged2GeV_R05_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged2GeV_R03_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged2GeV_R04_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged2GeV_R05_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged2GeV_R03_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged2GeV_R04_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged2GeV_R05_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-      vec_invXsec_iso_charged3GeV_R03_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged3GeV_R04_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged3GeV_R05_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged3GeV_R03_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged3GeV_R04_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged3GeV_R05_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged3GeV_R03_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged3GeV_R04_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_charged3GeV_R05_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-      vec_invXsec_iso_full2GeV_R03_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full2GeV_R04_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full2GeV_R05_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full2GeV_R03_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full2GeV_R04_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full2GeV_R05_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full2GeV_R03_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full2GeV_R04_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full2GeV_R05_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-
-      vec_invXsec_iso_full3GeV_R03_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full3GeV_R04_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full3GeV_R05_photons_etaTPC_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full3GeV_R03_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full3GeV_R04_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full3GeV_R05_photons_etaEMCal_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full3GeV_R03_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full3GeV_R04_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-      vec_invXsec_iso_full3GeV_R05_photons_etaPHOS_bin.at(iBin)->Scale(sigma);
-    }
+    pyHelp.Scale_InvXsec_Moments(iBin, sigma);
 
     //----------------------------------------------------------------------------------------------------
     vec_pTHat_bin.at(iBin)->Scale(sigma);
+    if(useTiming) pyHelp.Stop_Stage(PythiaAnalysisHelper::kScale);
+
+    if( checkpointInterval > 0 ){
+      if( pyHelp.Get_MPI_Size() > 1 ) pyHelp.Write_Checkpoint_MPI(checkpointName, runID, isMB ? pTHatBins : iBin+1);
+      else pyHelp.Write_Checkpoint(p, checkpointName, runID, isMB ? pTHatBins : iBin+1, 0, NULL, 0.);
+      lastCheckpoint = time(0);
+    }
 
     //---consider only first pthat bin for MB, because pthatbins do not apply for MB---
     if ( (!strcmp(argv[2],"MB") || !strcmp(argv[2],"MBVeto"))
@@ -1858,7 +1564,24 @@ int main(int argc, char **argv) {
       break;
   }// end of pTHat bin loop
 
+  if(useEventStore) pyHelp.Close_Event_Store(vec_weightSum_genInfo_bin);
+  if(useWeightLog) pyHelp.Close_Weight_Log();
+  if(isReplay) pyHelp.Close_Replay();
+  if(forkWorkers) pyHelp.Start_Writer(); // no fork() any more
+
+  // MPI: histograms of all ranks summed into rank 0, which writes the output
+  if( pyHelp.Get_MPI_Size() > 1 ){
+    bool isReduced = pyHelp.Reduce_Histograms_MPI();
+    if( !isReduced || pyHelp.Get_MPI_Rank() > 0 ){
+      pyHelp.Stop_Writer();
+      pyHelp.Finalize_MPI();
+      return isReduced ? 0 : 1;
+    }
+  }
+
   //--- write to root file ---------------------------------------
+  pyHelp.Start_Timing_Bin(-1);
+  if(useTiming) pyHelp.Start_Stage(PythiaAnalysisHelper::kWrite);
   TFile file(rootFileName, "RECREATE");
   
   //----------------------------------------------------------------------------------------------------
@@ -1867,11 +1590,12 @@ int main(int argc, char **argv) {
 
   // store weightSum for normalization later on (in standalone Pythia = number of events)
   for(int iBin=0; iBin < pTHatBins; iBin++){
-    vec_weightSum_bin.at(iBin)->Write();
+    pyHelp.Write_Async(&file, vec_weightSum_bin.at(iBin));
+    pyHelp.Write_Async(&file, vec_weightSum_genInfo_bin.at(iBin));
   }
-  h_weightSum->Write();
+  pyHelp.Write_Async(&file, h_weightSum);
 
-  TDirectory *dir_chJets = file.mkdir("chJets");
+  TDirectory *dir_chJets = pyHelp.Mkdir_Output(&file, "chJets");
   pyHelp.Add_Histos_Scale_Write2File( vec_chJets_pt_etaTPC_bin, h_chJets_pt_etaTPC , file, dir_chJets, 2*(etaTPC-jetRadius), false);
   pyHelp.Add_Histos_Scale_Write2File( vec_chJets_pt_leading_etaTPC_bin, h_chJets_pt_leading_etaTPC , file, dir_chJets, 2*(etaTPC-jetRadius), false);
 
@@ -1892,119 +1616,119 @@ int main(int argc, char **argv) {
 
   pyHelp.Add_Histos_Scale_Write2File( vec_xSecTriggerGamma_bin, h_xSecTriggerGamma, file, dir_chJets, 1., false);
 
-  TDirectory *dir_electron = file.mkdir("electron");
+  TDirectory *dir_electron = pyHelp.Mkdir_Output(&file, "electron");
   pyHelp.Add_Histos_Scale_Write2File( vec_electron_pt_topMotherID_bin, h2_electron_pt_topMotherID, file, dir_electron, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_electron_yDefault_bin, h_electron_yDefault, file, dir_electron, 2*yDefault, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_electron_etaLarge_bin, h_electron_etaLarge, file, dir_electron, 2*etaLarge, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_electron_etaTPC_bin, h_electron_etaTPC, file, dir_electron, 2*etaTPC, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_electron_etaEMCal_bin, h_electron_etaEMCal, file, dir_electron, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_electron_etaPHOS_bin, h_electron_etaPHOS, file, dir_electron, 2*etaPHOS, false);
+  pyHelp.Project_Scale_Write2File( vec_electron_yPt_bin, 0., yDefault, h_electron_yDefault, file, dir_electron, true);
+  pyHelp.Project_Scale_Write2File( vec_electron_etaPt_bin, 0., etaLarge, h_electron_etaLarge, file, dir_electron, false);
+  pyHelp.Project_Scale_Write2File( vec_electron_etaPt_bin, 0., etaTPC, h_electron_etaTPC, file, dir_electron, false);
+  pyHelp.Project_Scale_Write2File( vec_electron_etaPt_bin, 0., etaEMCal, h_electron_etaEMCal, file, dir_electron, false);
+  pyHelp.Project_Scale_Write2File( vec_electron_etaPt_bin, 0., etaPHOS, h_electron_etaPHOS, file, dir_electron, false);
 
-  TDirectory *dir_pTHat = file.mkdir("pTHat");
+  TDirectory *dir_pTHat = pyHelp.Mkdir_Output(&file, "pTHat");
   pyHelp.Add_Histos_Scale_Write2File( vec_pTHat_bin, h_pTHat, file, dir_pTHat, 1., false);
 
-  TDirectory *dir_pi0 = file.mkdir("pi0");
-  pyHelp.Add_Histos_Scale_Write2File( vec_pi0_yDefault_bin, h_pi0_yDefault, file, dir_pi0, 2*yDefault, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_pi0_etaLarge_bin, h_pi0_etaLarge, file, dir_pi0, 2*etaLarge, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_pi0_etaTPC_bin, h_pi0_etaTPC, file, dir_pi0, 2*etaTPC, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_pi0_etaEMCal_bin, h_pi0_etaEMCal, file, dir_pi0, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_pi0_etaPHOS_bin, h_pi0_etaPHOS, file, dir_pi0, 2*etaPHOS, false);
-
-  TDirectory *dir_pi0primary = file.mkdir("pi0primary");
-  pyHelp.Add_Histos_Scale_Write2File( vec_pi0primary_yDefault_bin, h_pi0primary_yDefault, file, dir_pi0primary, 2*yDefault, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_pi0primary_etaLarge_bin, h_pi0primary_etaLarge, file, dir_pi0primary, 2*etaLarge, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_pi0primary_etaTPC_bin, h_pi0primary_etaTPC, file, dir_pi0primary, 2*etaTPC, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_pi0primary_etaEMCal_bin, h_pi0primary_etaEMCal, file, dir_pi0primary, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_pi0primary_etaPHOS_bin, h_pi0primary_etaPHOS, file, dir_pi0primary, 2*etaPHOS, false);
-
-  TDirectory *dir_eta = file.mkdir("eta");
-  pyHelp.Add_Histos_Scale_Write2File( vec_eta_yDefault_bin, h_eta_yDefault, file, dir_eta, 2*yDefault, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_eta_etaLarge_bin, h_eta_etaLarge, file, dir_eta, 2*etaLarge, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_eta_etaTPC_bin, h_eta_etaTPC, file, dir_eta, 2*etaTPC, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_eta_etaEMCal_bin, h_eta_etaEMCal, file, dir_eta, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_eta_etaPHOS_bin, h_eta_etaPHOS, file, dir_eta, 2*etaPHOS, false);
-
-  TDirectory *dir_etaprime = file.mkdir("etaprime");
-  pyHelp.Add_Histos_Scale_Write2File( vec_etaprime_yDefault_bin, h_etaprime_yDefault, file, dir_etaprime, 2*yDefault, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_etaprime_etaLarge_bin, h_etaprime_etaLarge, file, dir_etaprime, 2*etaLarge, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_etaprime_etaTPC_bin, h_etaprime_etaTPC, file, dir_etaprime, 2*etaTPC, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_etaprime_etaEMCal_bin, h_etaprime_etaEMCal, file, dir_etaprime, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_etaprime_etaPHOS_bin, h_etaprime_etaPHOS, file, dir_etaprime, 2*etaPHOS, false);
-
-  TDirectory *dir_omega = file.mkdir("omega");
-  pyHelp.Add_Histos_Scale_Write2File( vec_omega_yDefault_bin, h_omega_yDefault, file, dir_omega, 2*yDefault, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_omega_etaLarge_bin, h_omega_etaLarge, file, dir_omega, 2*etaLarge, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_omega_etaTPC_bin, h_omega_etaTPC, file, dir_omega, 2*etaTPC, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_omega_etaEMCal_bin, h_omega_etaEMCal, file, dir_omega, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_omega_etaPHOS_bin, h_omega_etaPHOS, file, dir_omega, 2*etaPHOS, false);
-
-  TDirectory *dir_gamma = file.mkdir("gamma");
-  pyHelp.Add_Histos_Scale_Write2File( vec_direct_photons_yDefault_bin, h_direct_photons_yDefault, file, dir_gamma, 2*yDefault, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_direct_photons_etaLarge_bin, h_direct_photons_etaLarge, file, dir_gamma, 2*etaLarge, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_direct_photons_etaTPC_bin, h_direct_photons_etaTPC, file, dir_gamma, 2*etaTPC, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_direct_photons_etaEMCal_bin, h_direct_photons_etaEMCal, file, dir_gamma, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_direct_photons_etaPHOS_bin, h_direct_photons_etaPHOS, file, dir_gamma, 2*etaPHOS, false);
-
-  pyHelp.Add_Histos_Scale_Write2File( vec_shower_photons_yDefault_bin, h_shower_photons_yDefault, file, dir_gamma, 2*yDefault, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_shower_photons_etaLarge_bin, h_shower_photons_etaLarge, file, dir_gamma, 2*etaLarge, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_shower_photons_etaTPC_bin, h_shower_photons_etaTPC, file, dir_gamma, 2*etaTPC, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_shower_photons_etaEMCal_bin, h_shower_photons_etaEMCal, file, dir_gamma, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_shower_photons_etaPHOS_bin, h_shower_photons_etaPHOS, file, dir_gamma, 2*etaPHOS, false);
-
-  pyHelp.Add_Histos_Scale_Write2File( vec_222_photons_yDefault_bin, h_222_photons_yDefault, file, dir_gamma, 2*yDefault, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_222_photons_etaLarge_bin, h_222_photons_etaLarge, file, dir_gamma, 2*etaLarge, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_222_photons_etaTPC_bin, h_222_photons_etaTPC, file, dir_gamma, 2*etaTPC, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_222_photons_etaEMCal_bin, h_222_photons_etaEMCal, file, dir_gamma, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_222_photons_etaPHOS_bin, h_222_photons_etaPHOS, file, dir_gamma, 2*etaPHOS, false);
-
-  pyHelp.Add_Histos_Scale_Write2File( vec_decay_photons_yDefault_bin, h_decay_photons_yDefault, file, dir_gamma, 2*yDefault, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_decay_photons_etaLarge_bin, h_decay_photons_etaLarge, file, dir_gamma, 2*etaLarge, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_decay_photons_etaTPC_bin, h_decay_photons_etaTPC, file, dir_gamma, 2*etaTPC, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_decay_photons_etaEMCal_bin, h_decay_photons_etaEMCal, file, dir_gamma, 2*etaEMCal, false);
-  pyHelp.Add_Histos_Scale_Write2File( vec_decay_photons_etaPHOS_bin, h_decay_photons_etaPHOS, file, dir_gamma, 2*etaPHOS, false);
+  TDirectory *dir_pi0 = pyHelp.Mkdir_Output(&file, "pi0");
+  pyHelp.Project_Scale_Write2File( vec_pi0_yPt_bin, 0., yDefault, h_pi0_yDefault, file, dir_pi0, true);
+  pyHelp.Project_Scale_Write2File( vec_pi0_etaPt_bin, 0., etaLarge, h_pi0_etaLarge, file, dir_pi0, false);
+  pyHelp.Project_Scale_Write2File( vec_pi0_etaPt_bin, 0., etaTPC, h_pi0_etaTPC, file, dir_pi0, false);
+  pyHelp.Project_Scale_Write2File( vec_pi0_etaPt_bin, 0., etaEMCal, h_pi0_etaEMCal, file, dir_pi0, false);
+  pyHelp.Project_Scale_Write2File( vec_pi0_etaPt_bin, 0., etaPHOS, h_pi0_etaPHOS, file, dir_pi0, false);
+
+  TDirectory *dir_pi0primary = pyHelp.Mkdir_Output(&file, "pi0primary");
+  pyHelp.Project_Scale_Write2File( vec_pi0primary_yPt_bin, 0., yDefault, h_pi0primary_yDefault, file, dir_pi0primary, true);
+  pyHelp.Project_Scale_Write2File( vec_pi0primary_etaPt_bin, 0., etaLarge, h_pi0primary_etaLarge, file, dir_pi0primary, false);
+  pyHelp.Project_Scale_Write2File( vec_pi0primary_etaPt_bin, 0., etaTPC, h_pi0primary_etaTPC, file, dir_pi0primary, false);
+  pyHelp.Project_Scale_Write2File( vec_pi0primary_etaPt_bin, 0., etaEMCal, h_pi0primary_etaEMCal, file, dir_pi0primary, false);
+  pyHelp.Project_Scale_Write2File( vec_pi0primary_etaPt_bin, 0., etaPHOS, h_pi0primary_etaPHOS, file, dir_pi0primary, false);
+
+  TDirectory *dir_eta = pyHelp.Mkdir_Output(&file, "eta");
+  pyHelp.Project_Scale_Write2File( vec_eta_yPt_bin, 0., yDefault, h_eta_yDefault, file, dir_eta, true);
+  pyHelp.Project_Scale_Write2File( vec_eta_etaPt_bin, 0., etaLarge, h_eta_etaLarge, file, dir_eta, false);
+  pyHelp.Project_Scale_Write2File( vec_eta_etaPt_bin, 0., etaTPC, h_eta_etaTPC, file, dir_eta, false);
+  pyHelp.Project_Scale_Write2File( vec_eta_etaPt_bin, 0., etaEMCal, h_eta_etaEMCal, file, dir_eta, false);
+  pyHelp.Project_Scale_Write2File( vec_eta_etaPt_bin, 0., etaPHOS, h_eta_etaPHOS, file, dir_eta, false);
+
+  TDirectory *dir_etaprime = pyHelp.Mkdir_Output(&file, "etaprime");
+  pyHelp.Project_Scale_Write2File( vec_etaprime_yPt_bin, 0., yDefault, h_etaprime_yDefault, file, dir_etaprime, true);
+  pyHelp.Project_Scale_Write2File( vec_etaprime_etaPt_bin, 0., etaLarge, h_etaprime_etaLarge, file, dir_etaprime, false);
+  pyHelp.Project_Scale_Write2File( vec_etaprime_etaPt_bin, 0., etaTPC, h_etaprime_etaTPC, file, dir_etaprime, false);
+  pyHelp.Project_Scale_Write2File( vec_etaprime_etaPt_bin, 0., etaEMCal, h_etaprime_etaEMCal, file, dir_etaprime, false);
+  pyHelp.Project_Scale_Write2File( vec_etaprime_etaPt_bin, 0., etaPHOS, h_etaprime_etaPHOS, file, dir_etaprime, false);
+
+  TDirectory *dir_omega = pyHelp.Mkdir_Output(&file, "omega");
+  pyHelp.Project_Scale_Write2File( vec_omega_yPt_bin, 0., yDefault, h_omega_yDefault, file, dir_omega, true);
+  pyHelp.Project_Scale_Write2File( vec_omega_etaPt_bin, 0., etaLarge, h_omega_etaLarge, file, dir_omega, false);
+  pyHelp.Project_Scale_Write2File( vec_omega_etaPt_bin, 0., etaTPC, h_omega_etaTPC, file, dir_omega, false);
+  pyHelp.Project_Scale_Write2File( vec_omega_etaPt_bin, 0., etaEMCal, h_omega_etaEMCal, file, dir_omega, false);
+  pyHelp.Project_Scale_Write2File( vec_omega_etaPt_bin, 0., etaPHOS, h_omega_etaPHOS, file, dir_omega, false);
+
+  TDirectory *dir_gamma = pyHelp.Mkdir_Output(&file, "gamma");
+  pyHelp.Project_Scale_Write2File( vec_direct_photons_yPt_bin, 0., yDefault, h_direct_photons_yDefault, file, dir_gamma, true);
+  pyHelp.Project_Scale_Write2File( vec_direct_photons_etaPt_bin, 0., etaLarge, h_direct_photons_etaLarge, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_direct_photons_etaPt_bin, 0., etaTPC, h_direct_photons_etaTPC, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_direct_photons_etaPt_bin, 0., etaEMCal, h_direct_photons_etaEMCal, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_direct_photons_etaPt_bin, 0., etaPHOS, h_direct_photons_etaPHOS, file, dir_gamma, false);
+
+  pyHelp.Project_Scale_Write2File( vec_shower_photons_yPt_bin, 0., yDefault, h_shower_photons_yDefault, file, dir_gamma, true);
+  pyHelp.Project_Scale_Write2File( vec_shower_photons_etaPt_bin, 0., etaLarge, h_shower_photons_etaLarge, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_shower_photons_etaPt_bin, 0., etaTPC, h_shower_photons_etaTPC, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_shower_photons_etaPt_bin, 0., etaEMCal, h_shower_photons_etaEMCal, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_shower_photons_etaPt_bin, 0., etaPHOS, h_shower_photons_etaPHOS, file, dir_gamma, false);
+
+  pyHelp.Project_Scale_Write2File( vec_222_photons_yPt_bin, 0., yDefault, h_222_photons_yDefault, file, dir_gamma, true);
+  pyHelp.Project_Scale_Write2File( vec_222_photons_etaPt_bin, 0., etaLarge, h_222_photons_etaLarge, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_222_photons_etaPt_bin, 0., etaTPC, h_222_photons_etaTPC, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_222_photons_etaPt_bin, 0., etaEMCal, h_222_photons_etaEMCal, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_222_photons_etaPt_bin, 0., etaPHOS, h_222_photons_etaPHOS, file, dir_gamma, false);
+
+  pyHelp.Project_Scale_Write2File( vec_decay_photons_yPt_bin, 0., yDefault, h_decay_photons_yDefault, file, dir_gamma, true);
+  pyHelp.Project_Scale_Write2File( vec_decay_photons_etaPt_bin, 0., etaLarge, h_decay_photons_etaLarge, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_decay_photons_etaPt_bin, 0., etaTPC, h_decay_photons_etaTPC, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_decay_photons_etaPt_bin, 0., etaEMCal, h_decay_photons_etaEMCal, file, dir_gamma, false);
+  pyHelp.Project_Scale_Write2File( vec_decay_photons_etaPt_bin, 0., etaPHOS, h_decay_photons_etaPHOS, file, dir_gamma, false);
 
   if(producePhotonIsoSpectra){
-    TDirectory *dir_isoGamma = file.mkdir("isoGamma");
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged2GeV_R03_photons_etaTPC_bin, h_iso_charged2GeV_R03_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged2GeV_R04_photons_etaTPC_bin, h_iso_charged2GeV_R04_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged2GeV_R05_photons_etaTPC_bin, h_iso_charged2GeV_R05_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged2GeV_R03_photons_etaEMCal_bin, h_iso_charged2GeV_R03_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged2GeV_R04_photons_etaEMCal_bin, h_iso_charged2GeV_R04_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged2GeV_R05_photons_etaEMCal_bin, h_iso_charged2GeV_R05_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged2GeV_R03_photons_etaPHOS_bin, h_iso_charged2GeV_R03_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged2GeV_R04_photons_etaPHOS_bin, h_iso_charged2GeV_R04_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged2GeV_R05_photons_etaPHOS_bin, h_iso_charged2GeV_R05_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged3GeV_R03_photons_etaTPC_bin, h_iso_charged3GeV_R03_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged3GeV_R04_photons_etaTPC_bin, h_iso_charged3GeV_R04_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged3GeV_R05_photons_etaTPC_bin, h_iso_charged3GeV_R05_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged3GeV_R03_photons_etaEMCal_bin, h_iso_charged3GeV_R03_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged3GeV_R04_photons_etaEMCal_bin, h_iso_charged3GeV_R04_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged3GeV_R05_photons_etaEMCal_bin, h_iso_charged3GeV_R05_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged3GeV_R03_photons_etaPHOS_bin, h_iso_charged3GeV_R03_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged3GeV_R04_photons_etaPHOS_bin, h_iso_charged3GeV_R04_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_charged3GeV_R05_photons_etaPHOS_bin, h_iso_charged3GeV_R05_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-
-
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full2GeV_R03_photons_etaTPC_bin, h_iso_full2GeV_R03_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full2GeV_R04_photons_etaTPC_bin, h_iso_full2GeV_R04_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full2GeV_R05_photons_etaTPC_bin, h_iso_full2GeV_R05_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full2GeV_R03_photons_etaEMCal_bin, h_iso_full2GeV_R03_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full2GeV_R04_photons_etaEMCal_bin, h_iso_full2GeV_R04_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full2GeV_R05_photons_etaEMCal_bin, h_iso_full2GeV_R05_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full2GeV_R03_photons_etaPHOS_bin, h_iso_full2GeV_R03_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full2GeV_R04_photons_etaPHOS_bin, h_iso_full2GeV_R04_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full2GeV_R05_photons_etaPHOS_bin, h_iso_full2GeV_R05_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full3GeV_R03_photons_etaTPC_bin, h_iso_full3GeV_R03_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full3GeV_R04_photons_etaTPC_bin, h_iso_full3GeV_R04_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full3GeV_R05_photons_etaTPC_bin, h_iso_full3GeV_R05_photons_etaTPC, file, dir_isoGamma, 2*etaTPC, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full3GeV_R03_photons_etaEMCal_bin, h_iso_full3GeV_R03_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full3GeV_R04_photons_etaEMCal_bin, h_iso_full3GeV_R04_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full3GeV_R05_photons_etaEMCal_bin, h_iso_full3GeV_R05_photons_etaEMCal, file, dir_isoGamma, 2*etaEMCal, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full3GeV_R03_photons_etaPHOS_bin, h_iso_full3GeV_R03_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full3GeV_R04_photons_etaPHOS_bin, h_iso_full3GeV_R04_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
-    pyHelp.Add_Histos_Scale_Write2File( vec_iso_full3GeV_R05_photons_etaPHOS_bin, h_iso_full3GeV_R05_photons_etaPHOS, file, dir_isoGamma, 2*etaPHOS, false);
+    TDirectory *dir_isoGamma = pyHelp.Mkdir_Output(&file, "isoGamma");
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R03_photons_etaPt_bin, 0., etaTPC, h_iso_charged2GeV_R03_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R04_photons_etaPt_bin, 0., etaTPC, h_iso_charged2GeV_R04_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R05_photons_etaPt_bin, 0., etaTPC, h_iso_charged2GeV_R05_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R03_photons_etaPt_bin, 0., etaEMCal, h_iso_charged2GeV_R03_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R04_photons_etaPt_bin, 0., etaEMCal, h_iso_charged2GeV_R04_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R05_photons_etaPt_bin, 0., etaEMCal, h_iso_charged2GeV_R05_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R03_photons_etaPt_bin, 0., etaPHOS, h_iso_charged2GeV_R03_photons_etaPHOS, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R04_photons_etaPt_bin, 0., etaPHOS, h_iso_charged2GeV_R04_photons_etaPHOS, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R05_photons_etaPt_bin, 0., etaPHOS, h_iso_charged2GeV_R05_photons_etaPHOS, file, dir_isoGamma, false);
+
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R03_photons_etaPt_bin, 0., etaTPC, h_iso_charged3GeV_R03_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R04_photons_etaPt_bin, 0., etaTPC, h_iso_charged3GeV_R04_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R05_photons_etaPt_bin, 0., etaTPC, h_iso_charged3GeV_R05_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R03_photons_etaPt_bin, 0., etaEMCal, h_iso_charged3GeV_R03_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R04_photons_etaPt_bin, 0., etaEMCal, h_iso_charged3GeV_R04_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R05_photons_etaPt_bin, 0., etaEMCal, h_iso_charged3GeV_R05_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R03_photons_etaPt_bin, 0., etaPHOS, h_iso_charged3GeV_R03_photons_etaPHOS, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R04_photons_etaPt_bin, 0., etaPHOS, h_iso_charged3GeV_R04_photons_etaPHOS, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R05_photons_etaPt_bin, 0., etaPHOS, h_iso_charged3GeV_R05_photons_etaPHOS, file, dir_isoGamma, false);
+
+
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R03_photons_etaPt_bin, 0., etaTPC, h_iso_full2GeV_R03_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R04_photons_etaPt_bin, 0., etaTPC, h_iso_full2GeV_R04_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R05_photons_etaPt_bin, 0., etaTPC, h_iso_full2GeV_R05_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R03_photons_etaPt_bin, 0., etaEMCal, h_iso_full2GeV_R03_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R04_photons_etaPt_bin, 0., etaEMCal, h_iso_full2GeV_R04_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R05_photons_etaPt_bin, 0., etaEMCal, h_iso_full2GeV_R05_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R03_photons_etaPt_bin, 0., etaPHOS, h_iso_full2GeV_R03_photons_etaPHOS, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R04_photons_etaPt_bin, 0., etaPHOS, h_iso_full2GeV_R04_photons_etaPHOS, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R05_photons_etaPt_bin, 0., etaPHOS, h_iso_full2GeV_R05_photons_etaPHOS, file, dir_isoGamma, false);
+
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R03_photons_etaPt_bin, 0., etaTPC, h_iso_full3GeV_R03_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R04_photons_etaPt_bin, 0., etaTPC, h_iso_full3GeV_R04_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R05_photons_etaPt_bin, 0., etaTPC, h_iso_full3GeV_R05_photons_etaTPC, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R03_photons_etaPt_bin, 0., etaEMCal, h_iso_full3GeV_R03_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R04_photons_etaPt_bin, 0., etaEMCal, h_iso_full3GeV_R04_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R05_photons_etaPt_bin, 0., etaEMCal, h_iso_full3GeV_R05_photons_etaEMCal, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R03_photons_etaPt_bin, 0., etaPHOS, h_iso_full3GeV_R03_photons_etaPHOS, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R04_photons_etaPt_bin, 0., etaPHOS, h_iso_full3GeV_R04_photons_etaPHOS, file, dir_isoGamma, false);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R05_photons_etaPt_bin, 0., etaPHOS, h_iso_full3GeV_R05_photons_etaPHOS, file, dir_isoGamma, false);
 
 
     //
@@ -2079,113 +1803,188 @@ int main(int argc, char **argv) {
   // do the same jazz for invariant cross section histos ------------------------------------------
   //------------------------------------------------------------------------------------------
 
-  TDirectory *dir_pi0_invXsec = file.mkdir("pi0_invXsec");
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_pi0_yDefault_bin, h_invXsec_pi0_yDefault, file, dir_pi0_invXsec, 2.*yDefault, true, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_pi0_etaLarge_bin, h_invXsec_pi0_etaLarge, file, dir_pi0_invXsec, 2.*etaLarge, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_pi0_etaTPC_bin, h_invXsec_pi0_etaTPC, file, dir_pi0_invXsec, 2.*etaTPC, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_pi0_etaEMCal_bin, h_invXsec_pi0_etaEMCal, file, dir_pi0_invXsec, 2.*etaEMCal, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_pi0_etaPHOS_bin, h_invXsec_pi0_etaPHOS, file, dir_pi0_invXsec, 2.*etaPHOS, false, true);
-
-  TDirectory *dir_pi0primary_invXsec = file.mkdir("pi0primary_invXsec");
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_pi0primary_yDefault_bin, h_invXsec_pi0primary_yDefault, file, dir_pi0primary_invXsec, 2.*yDefault, true, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_pi0primary_etaLarge_bin, h_invXsec_pi0primary_etaLarge, file, dir_pi0primary_invXsec, 2.*etaLarge, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_pi0primary_etaTPC_bin, h_invXsec_pi0primary_etaTPC, file, dir_pi0primary_invXsec, 2.*etaTPC, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_pi0primary_etaEMCal_bin, h_invXsec_pi0primary_etaEMCal, file, dir_pi0primary_invXsec, 2.*etaEMCal, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_pi0primary_etaPHOS_bin, h_invXsec_pi0primary_etaPHOS, file, dir_pi0primary_invXsec, 2.*etaPHOS, false, true);
-
-  TDirectory *dir_eta_invXsec = file.mkdir("eta_invXsec");
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_eta_yDefault_bin, h_invXsec_eta_yDefault, file, dir_eta_invXsec, 2.*yDefault, true, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_eta_etaLarge_bin, h_invXsec_eta_etaLarge, file, dir_eta_invXsec, 2.*etaLarge, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_eta_etaTPC_bin, h_invXsec_eta_etaTPC, file, dir_eta_invXsec, 2.*etaTPC, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_eta_etaEMCal_bin, h_invXsec_eta_etaEMCal, file, dir_eta_invXsec, 2.*etaEMCal, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_eta_etaPHOS_bin, h_invXsec_eta_etaPHOS, file, dir_eta_invXsec, 2.*etaPHOS, false, true);
-
-  TDirectory *dir_etaprime_invXsec = file.mkdir("etaprime_invXsec");
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_etaprime_yDefault_bin, h_invXsec_etaprime_yDefault, file, dir_etaprime_invXsec, 2.*yDefault, true, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_etaprime_etaLarge_bin, h_invXsec_etaprime_etaLarge, file, dir_etaprime_invXsec, 2.*etaLarge, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_etaprime_etaTPC_bin, h_invXsec_etaprime_etaTPC, file, dir_etaprime_invXsec, 2.*etaTPC, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_etaprime_etaEMCal_bin, h_invXsec_etaprime_etaEMCal, file, dir_etaprime_invXsec, 2.*etaEMCal, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_etaprime_etaPHOS_bin, h_invXsec_etaprime_etaPHOS, file, dir_etaprime_invXsec, 2.*etaPHOS, false, true);
-
-  TDirectory *dir_omega_invXsec = file.mkdir("omega_invXsec");
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_omega_yDefault_bin, h_invXsec_omega_yDefault, file, dir_omega_invXsec, 2.*yDefault, true, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_omega_etaLarge_bin, h_invXsec_omega_etaLarge, file, dir_omega_invXsec, 2.*etaLarge, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_omega_etaTPC_bin, h_invXsec_omega_etaTPC, file, dir_omega_invXsec, 2.*etaTPC, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_omega_etaEMCal_bin, h_invXsec_omega_etaEMCal, file, dir_omega_invXsec, 2.*etaEMCal, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_omega_etaPHOS_bin, h_invXsec_omega_etaPHOS, file, dir_omega_invXsec, 2.*etaPHOS, false, true);
-
-  TDirectory *dir_gamma_invXsec = file.mkdir("gamma_invXsec");
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_direct_photons_yDefault_bin, h_invXsec_direct_photons_yDefault, file, dir_gamma_invXsec, 2.*yDefault, true, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_direct_photons_etaLarge_bin, h_invXsec_direct_photons_etaLarge, file, dir_gamma_invXsec, 2.*etaLarge, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_direct_photons_etaTPC_bin, h_invXsec_direct_photons_etaTPC, file, dir_gamma_invXsec, 2.*etaTPC, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_direct_photons_etaEMCal_bin, h_invXsec_direct_photons_etaEMCal, file, dir_gamma_invXsec, 2.*etaEMCal, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_direct_photons_etaPHOS_bin, h_invXsec_direct_photons_etaPHOS, file, dir_gamma_invXsec, 2.*etaPHOS, false, true);
-
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_shower_photons_yDefault_bin, h_invXsec_shower_photons_yDefault, file, dir_gamma_invXsec, 2.*yDefault, true, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_shower_photons_etaLarge_bin, h_invXsec_shower_photons_etaLarge, file, dir_gamma_invXsec, 2.*etaLarge, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_shower_photons_etaTPC_bin, h_invXsec_shower_photons_etaTPC, file, dir_gamma_invXsec, 2.*etaTPC, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_shower_photons_etaEMCal_bin, h_invXsec_shower_photons_etaEMCal, file, dir_gamma_invXsec, 2.*etaEMCal, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_shower_photons_etaPHOS_bin, h_invXsec_shower_photons_etaPHOS, file, dir_gamma_invXsec, 2.*etaPHOS, false, true);
-
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_222_photons_yDefault_bin, h_invXsec_222_photons_yDefault, file, dir_gamma_invXsec, 2.*yDefault, true, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_222_photons_etaLarge_bin, h_invXsec_222_photons_etaLarge, file, dir_gamma_invXsec, 2.*etaLarge, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_222_photons_etaTPC_bin, h_invXsec_222_photons_etaTPC, file, dir_gamma_invXsec, 2.*etaTPC, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_222_photons_etaEMCal_bin, h_invXsec_222_photons_etaEMCal, file, dir_gamma_invXsec, 2.*etaEMCal, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_222_photons_etaPHOS_bin, h_invXsec_222_photons_etaPHOS, file, dir_gamma_invXsec, 2.*etaPHOS, false, true);
-
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_decay_photons_yDefault_bin, h_invXsec_decay_photons_yDefault, file, dir_gamma_invXsec, 2.*yDefault, true, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_decay_photons_etaLarge_bin, h_invXsec_decay_photons_etaLarge, file, dir_gamma_invXsec, 2.*etaLarge, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_decay_photons_etaTPC_bin, h_invXsec_decay_photons_etaTPC, file, dir_gamma_invXsec, 2.*etaTPC, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_decay_photons_etaEMCal_bin, h_invXsec_decay_photons_etaEMCal, file, dir_gamma_invXsec, 2.*etaEMCal, false, true);
-  pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_decay_photons_etaPHOS_bin, h_invXsec_decay_photons_etaPHOS, file, dir_gamma_invXsec, 2.*etaPHOS, false, true);
+  TDirectory *dir_pi0_invXsec = pyHelp.Mkdir_Output(&file, "pi0_invXsec");
+  pyHelp.Project_Scale_Write2File( vec_pi0_yPt_bin, 0., yDefault, h_invXsec_pi0_yDefault, file, dir_pi0_invXsec, true, true);
+  pyHelp.Project_Scale_Write2File( vec_pi0_etaPt_bin, 0., etaLarge, h_invXsec_pi0_etaLarge, file, dir_pi0_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_pi0_etaPt_bin, 0., etaTPC, h_invXsec_pi0_etaTPC, file, dir_pi0_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_pi0_etaPt_bin, 0., etaEMCal, h_invXsec_pi0_etaEMCal, file, dir_pi0_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_pi0_etaPt_bin, 0., etaPHOS, h_invXsec_pi0_etaPHOS, file, dir_pi0_invXsec, false, true);
+
+  TDirectory *dir_pi0primary_invXsec = pyHelp.Mkdir_Output(&file, "pi0primary_invXsec");
+  pyHelp.Project_Scale_Write2File( vec_pi0primary_yPt_bin, 0., yDefault, h_invXsec_pi0primary_yDefault, file, dir_pi0primary_invXsec, true, true);
+  pyHelp.Project_Scale_Write2File( vec_pi0primary_etaPt_bin, 0., etaLarge, h_invXsec_pi0primary_etaLarge, file, dir_pi0primary_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_pi0primary_etaPt_bin, 0., etaTPC, h_invXsec_pi0primary_etaTPC, file, dir_pi0primary_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_pi0primary_etaPt_bin, 0., etaEMCal, h_invXsec_pi0primary_etaEMCal, file, dir_pi0primary_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_pi0primary_etaPt_bin, 0., etaPHOS, h_invXsec_pi0primary_etaPHOS, file, dir_pi0primary_invXsec, false, true);
+
+  TDirectory *dir_eta_invXsec = pyHelp.Mkdir_Output(&file, "eta_invXsec");
+  pyHelp.Project_Scale_Write2File( vec_eta_yPt_bin, 0., yDefault, h_invXsec_eta_yDefault, file, dir_eta_invXsec, true, true);
+  pyHelp.Project_Scale_Write2File( vec_eta_etaPt_bin, 0., etaLarge, h_invXsec_eta_etaLarge, file, dir_eta_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_eta_etaPt_bin, 0., etaTPC, h_invXsec_eta_etaTPC, file, dir_eta_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_eta_etaPt_bin, 0., etaEMCal, h_invXsec_eta_etaEMCal, file, dir_eta_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_eta_etaPt_bin, 0., etaPHOS, h_invXsec_eta_etaPHOS, file, dir_eta_invXsec, false, true);
+
+  TDirectory *dir_etaprime_invXsec = pyHelp.Mkdir_Output(&file, "etaprime_invXsec");
+  pyHelp.Project_Scale_Write2File( vec_etaprime_yPt_bin, 0., yDefault, h_invXsec_etaprime_yDefault, file, dir_etaprime_invXsec, true, true);
+  pyHelp.Project_Scale_Write2File( vec_etaprime_etaPt_bin, 0., etaLarge, h_invXsec_etaprime_etaLarge, file, dir_etaprime_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_etaprime_etaPt_bin, 0., etaTPC, h_invXsec_etaprime_etaTPC, file, dir_etaprime_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_etaprime_etaPt_bin, 0., etaEMCal, h_invXsec_etaprime_etaEMCal, file, dir_etaprime_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_etaprime_etaPt_bin, 0., etaPHOS, h_invXsec_etaprime_etaPHOS, file, dir_etaprime_invXsec, false, true);
+
+  TDirectory *dir_omega_invXsec = pyHelp.Mkdir_Output(&file, "omega_invXsec");
+  pyHelp.Project_Scale_Write2File( vec_omega_yPt_bin, 0., yDefault, h_invXsec_omega_yDefault, file, dir_omega_invXsec, true, true);
+  pyHelp.Project_Scale_Write2File( vec_omega_etaPt_bin, 0., etaLarge, h_invXsec_omega_etaLarge, file, dir_omega_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_omega_etaPt_bin, 0., etaTPC, h_invXsec_omega_etaTPC, file, dir_omega_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_omega_etaPt_bin, 0., etaEMCal, h_invXsec_omega_etaEMCal, file, dir_omega_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_omega_etaPt_bin, 0., etaPHOS, h_invXsec_omega_etaPHOS, file, dir_omega_invXsec, false, true);
+
+  TDirectory *dir_gamma_invXsec = pyHelp.Mkdir_Output(&file, "gamma_invXsec");
+  pyHelp.Project_Scale_Write2File( vec_direct_photons_yPt_bin, 0., yDefault, h_invXsec_direct_photons_yDefault, file, dir_gamma_invXsec, true, true);
+  pyHelp.Project_Scale_Write2File( vec_direct_photons_etaPt_bin, 0., etaLarge, h_invXsec_direct_photons_etaLarge, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_direct_photons_etaPt_bin, 0., etaTPC, h_invXsec_direct_photons_etaTPC, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_direct_photons_etaPt_bin, 0., etaEMCal, h_invXsec_direct_photons_etaEMCal, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_direct_photons_etaPt_bin, 0., etaPHOS, h_invXsec_direct_photons_etaPHOS, file, dir_gamma_invXsec, false, true);
+
+  pyHelp.Project_Scale_Write2File( vec_shower_photons_yPt_bin, 0., yDefault, h_invXsec_shower_photons_yDefault, file, dir_gamma_invXsec, true, true);
+  pyHelp.Project_Scale_Write2File( vec_shower_photons_etaPt_bin, 0., etaLarge, h_invXsec_shower_photons_etaLarge, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_shower_photons_etaPt_bin, 0., etaTPC, h_invXsec_shower_photons_etaTPC, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_shower_photons_etaPt_bin, 0., etaEMCal, h_invXsec_shower_photons_etaEMCal, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_shower_photons_etaPt_bin, 0., etaPHOS, h_invXsec_shower_photons_etaPHOS, file, dir_gamma_invXsec, false, true);
+
+  pyHelp.Project_Scale_Write2File( vec_222_photons_yPt_bin, 0., yDefault, h_invXsec_222_photons_yDefault, file, dir_gamma_invXsec, true, true);
+  pyHelp.Project_Scale_Write2File( vec_222_photons_etaPt_bin, 0., etaLarge, h_invXsec_222_photons_etaLarge, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_222_photons_etaPt_bin, 0., etaTPC, h_invXsec_222_photons_etaTPC, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_222_photons_etaPt_bin, 0., etaEMCal, h_invXsec_222_photons_etaEMCal, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_222_photons_etaPt_bin, 0., etaPHOS, h_invXsec_222_photons_etaPHOS, file, dir_gamma_invXsec, false, true);
+
+  pyHelp.Project_Scale_Write2File( vec_decay_photons_yPt_bin, 0., yDefault, h_invXsec_decay_photons_yDefault, file, dir_gamma_invXsec, true, true);
+  pyHelp.Project_Scale_Write2File( vec_decay_photons_etaPt_bin, 0., etaLarge, h_invXsec_decay_photons_etaLarge, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_decay_photons_etaPt_bin, 0., etaTPC, h_invXsec_decay_photons_etaTPC, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_decay_photons_etaPt_bin, 0., etaEMCal, h_invXsec_decay_photons_etaEMCal, file, dir_gamma_invXsec, false, true);
+  pyHelp.Project_Scale_Write2File( vec_decay_photons_etaPt_bin, 0., etaPHOS, h_invXsec_decay_photons_etaPHOS, file, dir_gamma_invXsec, false, true);
 
   if(producePhotonIsoSpectra){
-    TDirectory *dir_isoGamma_invXsec = file.mkdir("isoGamma_invXsec");
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged2GeV_R03_photons_etaTPC_bin, h_invXsec_iso_charged2GeV_R03_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged2GeV_R04_photons_etaTPC_bin, h_invXsec_iso_charged2GeV_R04_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged2GeV_R05_photons_etaTPC_bin, h_invXsec_iso_charged2GeV_R05_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged2GeV_R03_photons_etaEMCal_bin, h_invXsec_iso_charged2GeV_R03_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged2GeV_R04_photons_etaEMCal_bin, h_invXsec_iso_charged2GeV_R04_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged2GeV_R05_photons_etaEMCal_bin, h_invXsec_iso_charged2GeV_R05_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged2GeV_R03_photons_etaPHOS_bin, h_invXsec_iso_charged2GeV_R03_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged2GeV_R04_photons_etaPHOS_bin, h_invXsec_iso_charged2GeV_R04_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged2GeV_R05_photons_etaPHOS_bin, h_invXsec_iso_charged2GeV_R05_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged3GeV_R03_photons_etaTPC_bin, h_invXsec_iso_charged3GeV_R03_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged3GeV_R04_photons_etaTPC_bin, h_invXsec_iso_charged3GeV_R04_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged3GeV_R05_photons_etaTPC_bin, h_invXsec_iso_charged3GeV_R05_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged3GeV_R03_photons_etaEMCal_bin, h_invXsec_iso_charged3GeV_R03_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged3GeV_R04_photons_etaEMCal_bin, h_invXsec_iso_charged3GeV_R04_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged3GeV_R05_photons_etaEMCal_bin, h_invXsec_iso_charged3GeV_R05_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged3GeV_R03_photons_etaPHOS_bin, h_invXsec_iso_charged3GeV_R03_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged3GeV_R04_photons_etaPHOS_bin, h_invXsec_iso_charged3GeV_R04_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_charged3GeV_R05_photons_etaPHOS_bin, h_invXsec_iso_charged3GeV_R05_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-
-
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full2GeV_R03_photons_etaTPC_bin, h_invXsec_iso_full2GeV_R03_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full2GeV_R04_photons_etaTPC_bin, h_invXsec_iso_full2GeV_R04_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full2GeV_R05_photons_etaTPC_bin, h_invXsec_iso_full2GeV_R05_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full2GeV_R03_photons_etaEMCal_bin, h_invXsec_iso_full2GeV_R03_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full2GeV_R04_photons_etaEMCal_bin, h_invXsec_iso_full2GeV_R04_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full2GeV_R05_photons_etaEMCal_bin, h_invXsec_iso_full2GeV_R05_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full2GeV_R03_photons_etaPHOS_bin, h_invXsec_iso_full2GeV_R03_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full2GeV_R04_photons_etaPHOS_bin, h_invXsec_iso_full2GeV_R04_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full2GeV_R05_photons_etaPHOS_bin, h_invXsec_iso_full2GeV_R05_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full3GeV_R03_photons_etaTPC_bin, h_invXsec_iso_full3GeV_R03_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full3GeV_R04_photons_etaTPC_bin, h_invXsec_iso_full3GeV_R04_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full3GeV_R05_photons_etaTPC_bin, h_invXsec_iso_full3GeV_R05_photons_etaTPC, file, dir_isoGamma_invXsec, 2.*etaTPC, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full3GeV_R03_photons_etaEMCal_bin, h_invXsec_iso_full3GeV_R03_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full3GeV_R04_photons_etaEMCal_bin, h_invXsec_iso_full3GeV_R04_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full3GeV_R05_photons_etaEMCal_bin, h_invXsec_iso_full3GeV_R05_photons_etaEMCal, file, dir_isoGamma_invXsec, 2.*etaEMCal, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full3GeV_R03_photons_etaPHOS_bin, h_invXsec_iso_full3GeV_R03_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full3GeV_R04_photons_etaPHOS_bin, h_invXsec_iso_full3GeV_R04_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
-    pyHelp.Add_Histos_Scale_Write2File( vec_invXsec_iso_full3GeV_R05_photons_etaPHOS_bin, h_invXsec_iso_full3GeV_R05_photons_etaPHOS, file, dir_isoGamma_invXsec, 2.*etaPHOS, false, true);
+    TDirectory *dir_isoGamma_invXsec = pyHelp.Mkdir_Output(&file, "isoGamma_invXsec");
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R03_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_charged2GeV_R03_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R04_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_charged2GeV_R04_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R05_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_charged2GeV_R05_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R03_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_charged2GeV_R03_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R04_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_charged2GeV_R04_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R05_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_charged2GeV_R05_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R03_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_charged2GeV_R03_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R04_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_charged2GeV_R04_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged2GeV_R05_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_charged2GeV_R05_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R03_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_charged3GeV_R03_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R04_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_charged3GeV_R04_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R05_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_charged3GeV_R05_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R03_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_charged3GeV_R03_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R04_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_charged3GeV_R04_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R05_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_charged3GeV_R05_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R03_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_charged3GeV_R03_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R04_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_charged3GeV_R04_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_charged3GeV_R05_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_charged3GeV_R05_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+
+
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R03_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_full2GeV_R03_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R04_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_full2GeV_R04_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R05_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_full2GeV_R05_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R03_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_full2GeV_R03_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R04_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_full2GeV_R04_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R05_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_full2GeV_R05_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R03_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_full2GeV_R03_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R04_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_full2GeV_R04_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full2GeV_R05_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_full2GeV_R05_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R03_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_full3GeV_R03_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R04_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_full3GeV_R04_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R05_photons_etaPt_bin, 0., etaTPC, h_invXsec_iso_full3GeV_R05_photons_etaTPC, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R03_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_full3GeV_R03_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R04_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_full3GeV_R04_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R05_photons_etaPt_bin, 0., etaEMCal, h_invXsec_iso_full3GeV_R05_photons_etaEMCal, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R03_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_full3GeV_R03_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R04_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_full3GeV_R04_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
+    pyHelp.Project_Scale_Write2File( vec_iso_full3GeV_R05_photons_etaPt_bin, 0., etaPHOS, h_invXsec_iso_full3GeV_R05_photons_etaPHOS, file, dir_isoGamma_invXsec, false, true);
   }
 
 
+  //----------------------------------------------------------------------------------------------------
+  // |eta| (|y|) x pt accumulators for projections into arbitrary acceptances (macros/project_acceptance.C)
+  TDirectory *dir_etaPt = pyHelp.Mkdir_Output(&file, "etaPt");
+  pyHelp.Add_Histos_Write2File( vec_electron_yPt_bin, h2_electron_yPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_electron_etaPt_bin, h2_electron_etaPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_pi0_yPt_bin, h2_pi0_yPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_pi0_etaPt_bin, h2_pi0_etaPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_pi0primary_yPt_bin, h2_pi0primary_yPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_pi0primary_etaPt_bin, h2_pi0primary_etaPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_eta_yPt_bin, h2_eta_yPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_eta_etaPt_bin, h2_eta_etaPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_etaprime_yPt_bin, h2_etaprime_yPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_etaprime_etaPt_bin, h2_etaprime_etaPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_omega_yPt_bin, h2_omega_yPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_omega_etaPt_bin, h2_omega_etaPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_direct_photons_yPt_bin, h2_direct_photons_yPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_direct_photons_etaPt_bin, h2_direct_photons_etaPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_shower_photons_yPt_bin, h2_shower_photons_yPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_shower_photons_etaPt_bin, h2_shower_photons_etaPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_222_photons_yPt_bin, h2_222_photons_yPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_222_photons_etaPt_bin, h2_222_photons_etaPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_decay_photons_yPt_bin, h2_decay_photons_yPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_decay_photons_etaPt_bin, h2_decay_photons_etaPt, file, dir_etaPt);
+  pyHelp.Add_Histos_Write2File( vec_pi0_yPt_bin, h2_invXsec_pi0_yPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_pi0_etaPt_bin, h2_invXsec_pi0_etaPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_pi0primary_yPt_bin, h2_invXsec_pi0primary_yPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_pi0primary_etaPt_bin, h2_invXsec_pi0primary_etaPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_eta_yPt_bin, h2_invXsec_eta_yPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_eta_etaPt_bin, h2_invXsec_eta_etaPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_etaprime_yPt_bin, h2_invXsec_etaprime_yPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_etaprime_etaPt_bin, h2_invXsec_etaprime_etaPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_omega_yPt_bin, h2_invXsec_omega_yPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_omega_etaPt_bin, h2_invXsec_omega_etaPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_direct_photons_yPt_bin, h2_invXsec_direct_photons_yPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_direct_photons_etaPt_bin, h2_invXsec_direct_photons_etaPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_shower_photons_yPt_bin, h2_invXsec_shower_photons_yPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_shower_photons_etaPt_bin, h2_invXsec_shower_photons_etaPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_222_photons_yPt_bin, h2_invXsec_222_photons_yPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_222_photons_etaPt_bin, h2_invXsec_222_photons_etaPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_decay_photons_yPt_bin, h2_invXsec_decay_photons_yPt, file, dir_etaPt, true);
+  pyHelp.Add_Histos_Write2File( vec_decay_photons_etaPt_bin, h2_invXsec_decay_photons_etaPt, file, dir_etaPt, true);
+  if(producePhotonIsoSpectra){
+    pyHelp.Add_Histos_Write2File( vec_iso_charged2GeV_R03_photons_etaPt_bin, h2_iso_charged2GeV_R03_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged2GeV_R04_photons_etaPt_bin, h2_iso_charged2GeV_R04_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged2GeV_R05_photons_etaPt_bin, h2_iso_charged2GeV_R05_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged3GeV_R03_photons_etaPt_bin, h2_iso_charged3GeV_R03_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged3GeV_R04_photons_etaPt_bin, h2_iso_charged3GeV_R04_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged3GeV_R05_photons_etaPt_bin, h2_iso_charged3GeV_R05_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_full2GeV_R03_photons_etaPt_bin, h2_iso_full2GeV_R03_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_full2GeV_R04_photons_etaPt_bin, h2_iso_full2GeV_R04_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_full2GeV_R05_photons_etaPt_bin, h2_iso_full2GeV_R05_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_full3GeV_R03_photons_etaPt_bin, h2_iso_full3GeV_R03_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_full3GeV_R04_photons_etaPt_bin, h2_iso_full3GeV_R04_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_full3GeV_R05_photons_etaPt_bin, h2_iso_full3GeV_R05_photons_etaPt, file, dir_etaPt);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged2GeV_R03_photons_etaPt_bin, h2_invXsec_iso_charged2GeV_R03_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged2GeV_R04_photons_etaPt_bin, h2_invXsec_iso_charged2GeV_R04_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged2GeV_R05_photons_etaPt_bin, h2_invXsec_iso_charged2GeV_R05_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged3GeV_R03_photons_etaPt_bin, h2_invXsec_iso_charged3GeV_R03_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged3GeV_R04_photons_etaPt_bin, h2_invXsec_iso_charged3GeV_R04_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_charged3GeV_R05_photons_etaPt_bin, h2_invXsec_iso_charged3GeV_R05_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_full2GeV_R03_photons_etaPt_bin, h2_invXsec_iso_full2GeV_R03_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_full2GeV_R04_photons_etaPt_bin, h2_invXsec_iso_full2GeV_R04_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_full2GeV_R05_photons_etaPt_bin, h2_invXsec_iso_full2GeV_R05_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_full3GeV_R03_photons_etaPt_bin, h2_invXsec_iso_full3GeV_R03_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_full3GeV_R04_photons_etaPt_bin, h2_invXsec_iso_full3GeV_R04_photons_etaPt, file, dir_etaPt, true);
+    pyHelp.Add_Histos_Write2File( vec_iso_full3GeV_R05_photons_etaPt_bin, h2_invXsec_iso_full3GeV_R05_photons_etaPt, file, dir_etaPt, true);
+  }
+
   //-----------------------------
+  pyHelp.Stop_Writer(); // final flush
+  if(useTiming) pyHelp.Stop_Stage(PythiaAnalysisHelper::kWrite);
+  pyHelp.Write_Timing(file);
   file.Close();
 
+  if( checkpointInterval > 0 ) remove(checkpointName);
+  pyHelp.Close_Progress();
+  pyHelp.Finalize_MPI();
+
   return 0;
 }
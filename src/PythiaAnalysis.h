@@ -46,6 +46,8 @@ const double yDefault = 0.8,
   etaEMCal = 0.66,
   etaPHOS = 0.12;
 
+const double etaAccMax = 5.3; // range of the |eta| x pt accumulators (|y|: yDefault), acceptances above are projected from them
+
 const char *electronMotherName[17] = {"all",
 				      "neg","pos",
 				      "Baryons",
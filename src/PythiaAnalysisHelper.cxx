@@ -8,7 +8,29 @@
 #include "TROOT.h"
 #include "TCanvas.h"
 #include "TPaveText.h"
+#include "TParameter.h"
+#include "TObjString.h"
+#include "TVectorD.h"
+#include "Compression.h"
 #include "fastjet/ClusterSequence.hh"
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <csignal>
+#include <cerrno>
+#include <cstring>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#endif
 
 using fastjet::PseudoJet;
 using fastjet::JetDefinition;
@@ -28,6 +50,391 @@ void PythiaAnalysisHelper::Set_Pythia_Randomseed(Pythia8::Pythia &p){
   return;
 }
 
+//----------------------------------------------------------------------
+// splitmix64 finalizer, neighbouring inputs give uncorrelated outputs
+static unsigned long long Mix_Seed(unsigned long long x){
+
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Set_Campaign_Seed(const char *taskID){
+
+  char *end;
+  campaignSeed = strtoull(getenv("SEED"), &end, 10);
+  if( end == getenv("SEED") || *end ){
+    printf("Set_Campaign_Seed: SEED = %s is no integer\n", getenv("SEED"));
+    return false;
+  }
+  // task ID: output name of the array task (argv[1]), otherwise SLURM_ARRAY_TASK_ID
+  campaignTask = strtol(taskID, &end, 10);
+  if( end == taskID || *end || campaignTask < 0 ){
+    const char *slurmTask = getenv("SLURM_ARRAY_TASK_ID");
+    campaignTask = slurmTask ? strtol(slurmTask, &end, 10) : -1;
+    if( !slurmTask || end == slurmTask || *end || campaignTask < 0 ){
+      printf("Set_Campaign_Seed: no task ID in \"%s\" or SLURM_ARRAY_TASK_ID\n", taskID);
+      return false;
+    }
+  }
+  if( (campaignTask+1)*maxSeedThreads*maxSeedBins > 900000000L ){
+    printf("Set_Campaign_Seed: task ID %ld too large for distinct seeds\n", campaignTask);
+    return false;
+  }
+  useCampaignSeed = true;
+  printf("\nUsing campaign seed %llu, task %ld\n", campaignSeed, campaignTask);
+  return true;
+}
+
+//----------------------------------------------------------------------
+long PythiaAnalysisHelper::Get_Stream_Seed(int iBin, int iThread){
+
+  long stream = (campaignTask*maxSeedThreads + iThread)*maxSeedBins + iBin;
+  return 1 + (long)( (Mix_Seed(campaignSeed) % 900000000ULL + stream) % 900000000ULL ); // Pythia seeds 1 - 900000000
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Set_Stream_Seed(Pythia8::Pythia &p, int iBin, int iThread){
+
+  if(!useCampaignSeed) return;
+  if( iBin < 0 || iBin >= maxSeedBins || iThread < 0 || iThread >= maxSeedThreads ){
+    printf("Set_Stream_Seed: pTHat bin %d or thread %d out of range, keeping seed %d\n", iBin, iThread, p.settings.mode("Random:seed"));
+    return;
+  }
+  p.readString("Random:setSeed = on");
+  p.readString(Form("Random:seed = %ld", Get_Stream_Seed(iBin, iThread)));
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Init_MPI(int *argc, char ***argv){
+
+#ifdef USE_MPI
+  int provided; // MPI is only called from the main thread, the writer thread does not communicate
+  MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &provided);
+  MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+  MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+  long seed = getenv("SEED") ? 0 : (long)time(0);
+  MPI_Bcast(&seed, 1, MPI_LONG, 0, MPI_COMM_WORLD);
+  if(seed) setenv("SEED", Form("%ld", seed), 1);
+  if(mpiRank == 0) printf("\nMPI mode: %d ranks\n", mpiSize);
+#else
+  (void)argc;
+  (void)argv;
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Sync_Bin_MPI(int iBin, double nEvents, bool stop){
+
+#ifdef USE_MPI
+  double local[2] = { nEvents, stop ? 1. : 0. }, global[2];
+  MPI_Allreduce(local, global, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  if(mpiRank == 0) printf("MPI progress: %.0f events of %d ranks before pTHat bin %d%s\n", global[0], mpiSize, iBin, global[1] > 0. ? ", stop requested" : "");
+  return global[1] > 0.;
+#else
+  (void)iBin;
+  (void)nEvents;
+  return stop;
+#endif
+}
+
+#ifdef USE_MPI
+// sum of data over all ranks in rank 0 (the other ranks keep their values)
+static void Reduce_Sum_MPI(double *data, int n, int rank){
+
+  MPI_Reduce(rank == 0 ? MPI_IN_PLACE : data, data, n, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+}
+// sum of data over all ranks into sum of rank 0 (data unchanged, sum unused in the other ranks)
+static void Reduce_Sum_MPI(double *data, double *sum, int n){
+
+  MPI_Reduce(data, sum, n, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Check_Booking_MPI(std::vector<TH1*> &histos, const char *caller){
+
+  long local[2] = { (long)histos.size(), Get_Histogram_Buffer_Size(histos) }, minimum[2], maximum[2];
+  MPI_Allreduce(local, minimum, 2, MPI_LONG, MPI_MIN, MPI_COMM_WORLD);
+  MPI_Allreduce(local, maximum, 2, MPI_LONG, MPI_MAX, MPI_COMM_WORLD);
+  if( minimum[0] != maximum[0] || minimum[1] != maximum[1] ){
+    if(mpiRank == 0) printf("%s: the ranks booked different histograms (%ld - %ld histograms, %ld - %ld values)\n", caller, minimum[0], maximum[0], minimum[1], maximum[1]);
+    return false;
+  }
+  return true;
+}
+#endif
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Reduce_Histograms_MPI(std::vector<TH1*> extraHistos){
+
+#ifdef USE_MPI
+  Flush_Writer(); // no checkpoint copies in memory any more
+
+  // same booking order on all ranks, checked by the number of histograms and doubles
+  std::vector<TH1*> histos = Get_Histograms_In_Memory();
+  for(unsigned int i = 0; i < extraHistos.size(); i++)
+    if( dynamic_cast<TArrayD*>(extraHistos.at(i)) && std::find(histos.begin(), histos.end(), extraHistos.at(i)) == histos.end() )
+      histos.push_back(extraHistos.at(i));
+  if( !Check_Booking_MPI(histos, "Reduce_Histograms_MPI") ) return false;
+
+  for(unsigned int i = 0; i < histos.size(); i++){
+    TH1 *h = histos.at(i);
+    Reduce_Sum_MPI(dynamic_cast<TArrayD*>(h)->GetArray(), h->GetNcells(), mpiRank);
+    if( h->GetSumw2N() ) Reduce_Sum_MPI(h->GetSumw2()->GetArray(), h->GetSumw2N(), mpiRank);
+    double stats[14] = {0.}; // TH1::GetStats fills up to 13 (TH3), entries last
+    h->GetStats(stats);
+    stats[13] = h->GetEntries();
+    Reduce_Sum_MPI(stats, 14, mpiRank);
+    if(mpiRank == 0){
+      h->PutStats(stats);
+      h->SetEntries(stats[13]);
+    }
+    InvXsecMoments *mom = Find_InvXsec_Moments(h);
+    if(mom){
+      Reduce_Sum_MPI(mom->sumInvPt.data(), mom->sumInvPt.size(), mpiRank);
+      Reduce_Sum_MPI(mom->sumInvPt2.data(), mom->sumInvPt2.size(), mpiRank);
+    }
+  }
+  if(mpiRank == 0) printf("Reduce_Histograms_MPI: %lu histograms of %d ranks summed\n", (unsigned long)histos.size(), mpiSize);
+#endif
+  return true;
+}
+
+//----------------------------------------------------------------------
+// between pTHat bins, called by all ranks: the sums go into detached copies on rank 0, so every rank
+// keeps its own histograms for the final reduction; no random state is stored, each bin starts from its stream seed
+bool PythiaAnalysisHelper::Write_Checkpoint_MPI(const char *fileName, const char *runID, int iBin){
+
+#ifdef USE_MPI
+  Flush_Writer(); // at most one snapshot in memory: wait for the previous checkpoint
+
+  std::vector<TH1*> histos = Get_Histograms_In_Memory();
+  if( !Check_Booking_MPI(histos, "Write_Checkpoint_MPI") ) return false;
+
+  std::vector< std::pair<string, TObject*> > snapshot;
+  bool status = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  for(unsigned int i = 0; i < histos.size(); i++){
+    TH1 *h = histos.at(i);
+    TH1 *copy = mpiRank == 0 ? (TH1*)h->Clone() : NULL;
+    Reduce_Sum_MPI(dynamic_cast<TArrayD*>(h)->GetArray(), copy ? dynamic_cast<TArrayD*>(copy)->GetArray() : NULL, h->GetNcells());
+    if( h->GetSumw2N() ) Reduce_Sum_MPI(h->GetSumw2()->GetArray(), copy ? copy->GetSumw2()->GetArray() : NULL, h->GetSumw2N());
+    double stats[14] = {0.}, sumStats[14]; // as in Reduce_Histograms_MPI
+    h->GetStats(stats);
+    stats[13] = h->GetEntries();
+    Reduce_Sum_MPI(stats, sumStats, 14);
+    InvXsecMoments *mom = Find_InvXsec_Moments(h);
+    std::vector<double> sumInvPt, sumInvPt2;
+    if(mom){
+      if(mpiRank == 0){
+	sumInvPt.resize(mom->sumInvPt.size());
+	sumInvPt2.resize(mom->sumInvPt2.size());
+      }
+      Reduce_Sum_MPI(mom->sumInvPt.data(), sumInvPt.data(), mom->sumInvPt.size());
+      Reduce_Sum_MPI(mom->sumInvPt2.data(), sumInvPt2.data(), mom->sumInvPt2.size());
+    }
+    if(mpiRank > 0) continue;
+    copy->PutStats(sumStats);
+    copy->SetEntries(sumStats[13]);
+    snapshot.push_back(std::make_pair(string(h->GetName()), copy));
+    if(mom){
+      snapshot.push_back(std::make_pair(string(Form("checkpoint_sumInvPt_%s", h->GetName())), new TVectorD(sumInvPt.size(), sumInvPt.data())));
+      snapshot.push_back(std::make_pair(string(Form("checkpoint_sumInvPt2_%s", h->GetName())), new TVectorD(sumInvPt2.size(), sumInvPt2.data())));
+    }
+  }
+  TH1::AddDirectory(status);
+  if(mpiRank > 0) return true;
+
+  snapshot.push_back(std::make_pair(string("checkpoint_runID"), new TObjString(runID)));
+  snapshot.push_back(std::make_pair(string("checkpoint_random"), new TObjString("")));
+  snapshot.push_back(std::make_pair(string("checkpoint_iBin"), new TParameter<int>("checkpoint_iBin", iBin)));
+  snapshot.push_back(std::make_pair(string("checkpoint_iEvent"), new TParameter<int>("checkpoint_iEvent", 0)));
+  Submit_Checkpoint(snapshot, Form("%s.tmp", fileName), fileName, iBin, 0);
+  return true;
+#else
+  (void)fileName;
+  (void)runID;
+  (void)iBin;
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Read_Checkpoint_MPI(const char *fileName, const char *runID, int &iBin){
+
+#ifdef USE_MPI
+  int iEvent = 0;
+  if( mpiRank > 0 || !Read_Checkpoint(fileName, runID, iBin, iEvent) ) iBin = -1;
+  MPI_Bcast(&iBin, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  return iBin >= 0;
+#else
+  (void)fileName;
+  (void)runID;
+  (void)iBin;
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Finalize_MPI(){
+
+#ifdef USE_MPI
+  MPI_Finalize();
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------
+std::vector<TH1*> PythiaAnalysisHelper::Get_Histograms_In_Memory(){
+
+  std::vector<TH1*> histos;
+  TIter next(gROOT->GetList());
+  while( TObject *obj = next() )
+    if( obj->InheritsFrom(TH1::Class()) && dynamic_cast<TArrayD*>(obj) ) histos.push_back((TH1*)obj);
+  return histos;
+}
+
+//----------------------------------------------------------------------
+// per histogram: bin contents, sumw2, 13 statistics + entries, 1/pT moments
+long PythiaAnalysisHelper::Get_Histogram_Buffer_Size(std::vector<TH1*> &histos){
+
+  long size = 0;
+  for(unsigned int i = 0; i < histos.size(); i++){
+    size += histos.at(i)->GetNcells() + histos.at(i)->GetSumw2N() + 14;
+    InvXsecMoments *mom = Find_InvXsec_Moments(histos.at(i));
+    if(mom) size += mom->sumInvPt.size() + mom->sumInvPt2.size();
+  }
+  return size;
+}
+
+//----------------------------------------------------------------------
+int PythiaAnalysisHelper::Fork_Workers(Pythia8::Pythia &p, int iBin, int nWorkers){
+
+  if( useCampaignSeed && nWorkers > maxSeedThreads ){
+    printf("Fork_Workers: at most %d workers with distinct campaign streams, using %d\n", maxSeedThreads, maxSeedThreads);
+    nWorkers = maxSeedThreads;
+  }
+  fflush(stdout);
+  std::vector<int> pipes;
+  std::vector<pid_t> pids;
+  for(int iWorker = 0; iWorker < nWorkers; iWorker++){
+    int fd[2];
+    if( pipe(fd) ){
+      printf("Fork_Workers: no pipe for worker %d, continuing with %d workers\n", iWorker, iWorker);
+      break;
+    }
+    pid_t pid = fork();
+    if( pid == 0 ){ // worker: starts from empty histograms, so only the events of this bin are returned
+      for(unsigned int i = 0; i < pipes.size(); i++) close(pipes.at(i));
+      close(fd[0]);
+      workerPipe = fd[1];
+      std::vector<TH1*> histos = Get_Histograms_In_Memory();
+      for(unsigned int i = 0; i < histos.size(); i++){
+	histos.at(i)->Reset();
+	InvXsecMoments *mom = Find_InvXsec_Moments(histos.at(i));
+	if(mom){
+	  std::fill(mom->sumInvPt.begin(), mom->sumInvPt.end(), 0.);
+	  std::fill(mom->sumInvPt2.begin(), mom->sumInvPt2.end(), 0.);
+	}
+      }
+      // campaign stream of this worker, otherwise hashed from the seed of the bin
+      long seed = useCampaignSeed ? Get_Stream_Seed(iBin, iWorker) : Get_Event_Seed(p.settings.mode("Random:seed"), iBin, -1 - iWorker);
+      p.readString(Form("Random:seed = %ld", seed));
+      p.rndm.init(seed);
+      return iWorker;
+    }
+    close(fd[1]);
+    if( pid < 0 ){
+      close(fd[0]);
+      printf("Fork_Workers: could not fork worker %d, continuing with %d workers\n", iWorker, iWorker);
+      break;
+    }
+    pipes.push_back(fd[0]);
+    pids.push_back(pid);
+  }
+
+  // server: sum of the histograms of all workers
+  std::vector<TH1*> histos = Get_Histograms_In_Memory();
+  int nReturned = 0;
+  for(unsigned int i = 0; i < pipes.size(); i++){
+    if( Read_Worker_Histograms(pipes.at(i), histos) ) nReturned++;
+    else printf("Fork_Workers: worker %d of pTHat bin %d did not return its histograms, its events are lost\n", i, iBin);
+    int status;
+    waitpid(pids.at(i), &status, 0);
+  }
+  printf("Fork_Workers: %d of %d workers of pTHat bin %d returned\n", nReturned, nWorkers, iBin);
+  return -1;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Return_To_Server(){
+
+  std::vector<TH1*> histos = Get_Histograms_In_Memory();
+  long size = Get_Histogram_Buffer_Size(histos);
+  FILE *out = fdopen(workerPipe, "w");
+  fwrite(&size, sizeof(long), 1, out);
+  for(unsigned int i = 0; i < histos.size(); i++){
+    TH1 *h = histos.at(i);
+    fwrite(dynamic_cast<TArrayD*>(h)->GetArray(), sizeof(double), h->GetNcells(), out);
+    if( h->GetSumw2N() ) fwrite(h->GetSumw2()->GetArray(), sizeof(double), h->GetSumw2N(), out);
+    double stats[14] = {0.};
+    h->GetStats(stats);
+    stats[13] = h->GetEntries();
+    fwrite(stats, sizeof(double), 14, out);
+    InvXsecMoments *mom = Find_InvXsec_Moments(h);
+    if(mom){
+      fwrite(mom->sumInvPt.data(), sizeof(double), mom->sumInvPt.size(), out);
+      fwrite(mom->sumInvPt2.data(), sizeof(double), mom->sumInvPt2.size(), out);
+    }
+  }
+  fclose(out);
+  fflush(stdout);
+  _exit(0); // no destructors: the writer thread of the server does not exist in the worker
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Read_Worker_Histograms(int fd, std::vector<TH1*> &histos){
+
+  // read completely before adding, a crashed worker must not leave half a bin
+  FILE *in = fdopen(fd, "r");
+  long size = 0, expected = Get_Histogram_Buffer_Size(histos);
+  std::vector<double> buffer;
+  bool isComplete = fread(&size, sizeof(long), 1, in) == 1 && size == expected;
+  if(isComplete){
+    buffer.resize(size);
+    isComplete = (long)fread(buffer.data(), sizeof(double), size, in) == size;
+  }
+  fclose(in);
+  if(!isComplete) return false;
+
+  const double *value = buffer.data();
+  for(unsigned int i = 0; i < histos.size(); i++){
+    TH1 *h = histos.at(i);
+    double *contents = dynamic_cast<TArrayD*>(h)->GetArray();
+    for(int j = 0; j < h->GetNcells(); j++) contents[j] += *value++;
+    if( h->GetSumw2N() ){
+      double *sumw2 = h->GetSumw2()->GetArray();
+      for(int j = 0; j < h->GetSumw2N(); j++) sumw2[j] += *value++;
+    }
+    double stats[14] = {0.};
+    h->GetStats(stats);
+    stats[13] = h->GetEntries();
+    for(int j = 0; j < 14; j++) stats[j] += *value++;
+    h->PutStats(stats);
+    h->SetEntries(stats[13]);
+    InvXsecMoments *mom = Find_InvXsec_Moments(h);
+    if(mom){
+      for(unsigned int j = 0; j < mom->sumInvPt.size(); j++) mom->sumInvPt.at(j) += *value++;
+      for(unsigned int j = 0; j < mom->sumInvPt2.size(); j++) mom->sumInvPt2.at(j) += *value++;
+    }
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Pass_Parameters_To_Pythia(Pythia8::Pythia &p, int argc, char **argv){
 
@@ -69,69 +476,1159 @@ void PythiaAnalysisHelper::Pass_Parameters_To_Pythia(Pythia8::Pythia &p, int arg
       p.readString("Tune:pp = 14");
       printf("\nFull pythia events will be generated using Monash 2013 tune\n");
     }
-    else if (!strcmp(argv[5], "fullEventsTune4C"))
-    {
-      p.readString("Tune:pp = 5");
-      printf("\nFull pythia events will be generated using Tune 4C tune\n");
+    else if (!strcmp(argv[5], "fullEventsTune4C"))
+    {
+      p.readString("Tune:pp = 5");
+      printf("\nFull pythia events will be generated using Tune 4C tune\n");
+    }
+    else
+      printf("\nNo sensible argument argv[5] is given -> full pythia events will be generated (default)\n");
+  }
+  
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Write_README(Pythia8::Pythia &p, TFile &file, int argc, char **argv, string pdfA, string pdfB, double *pTHatBin){
+
+  file.cd();
+  string infoPDFA, infoPDFB, infoEnergyA, infoEnergyB, infoProcess, infoOption, infoRenScale, infoFacScale;
+
+  if( !strcmp(argv[2],"JJ") ) infoProcess = "Using JetJet processes (codes 111-124)";
+  else if( !strcmp(argv[2],"GJ") ) infoProcess = "Using GammaJet processes (codes 201-205)";
+  else if( !strcmp(argv[2],"WeakBoson" ) ) infoProcess = "Using single weak boson production processes (codes 224,225)";
+  else if( !strcmp(argv[2],"MB" ) ) infoProcess = "Using Minimum Bias production processes (codes 101,103-106)";
+  else if( !strcmp(argv[2],"MBVeto" ) ) infoProcess = Form("Using Minimum Bias production processes (codes 101,103-106), but only below pthat = %f GeV, so that other processes can be used for high pt statistics",pTHatBin[0]);
+
+  infoEnergyA = p.event.size() > 2 ? Form("%f", p.event[1].e()) : "unknown";
+  infoEnergyB = p.event.size() > 2 ? Form("%f", p.event[2].e()) : "unknown";
+
+  if( !strcmp(argv[5],"fullEvents") ) infoOption = "Full events have been processed (including hadronization, MPI etc...)";
+  if( !strcmp(argv[5],"fullEventsMonash") ) infoOption = "Full events have been processed (including hadronization, MPI etc...) using the Monash 2013 tune";
+  if( !strcmp(argv[5],"fullEventsTune4C") ) infoOption = "Full events have been processed (including hadronization, MPI etc...) using the Tune 4C";
+  if( !strcmp(argv[5],"noMPI") ) infoOption = "BEWARE: events have been processed without Multiparton Interaction";
+  if( !strcmp(argv[5],"noMPInoHadro") ) infoOption = "BEWARE: events have been processed without Multiparton Interaction and without hadronization";
+  if( !strcmp(argv[5],"noShower") ) infoOption = "BEWARE: events have been processed without any parton shower, only the naked hard process";
+    
+  if( argc >= 7 ) infoRenScale = Form("Using renormalization scale: #mu_{R} = Q^{2} #times %s", argv[6]);
+  else infoRenScale = "Using renormalization scale: #mu^{2}_{R} = Q^{2} #times 1.00";
+  if( argc >= 8 ) infoFacScale = Form("Using factorization scale: #mu_{F} = Q^{2} #times %s", argv[7]);
+  else infoFacScale = "Using factorization scale: #mu^{2}_{F} = Q^{2} #times 1.00";
+
+  if(argc >= 10) infoPDFA = pdfA;
+  else infoPDFA = "NNPDF2.3 QCD+QED LO";
+
+  if(argc >= 11) infoPDFB = pdfB; 
+  else infoPDFB = "NNPDF2.3 QCD+QED LO";
+
+  TCanvas *c = new TCanvas(Form("README_%s",argv[2]),Form("README_%s",argv[2]));
+  TPaveText *pt = new TPaveText(.01,.01,.99,.99);
+  pt->AddText("Generated with Pythia 8.230 and following config:");
+  pt->AddText(Form("PDF beam A = %s", infoPDFA.c_str()));
+  pt->AddText(Form("PDF beam B = %s", infoPDFB.c_str()));
+  pt->AddText(Form("Energy beam A = %s GeV", infoEnergyA.c_str()));
+  pt->AddText(Form("Energy beam B = %s GeV", infoEnergyB.c_str()));
+  pt->AddText(Form("%s", infoOption.c_str()));
+  pt->AddText(Form("%s", infoRenScale.c_str()));
+  pt->AddText(Form("%s", infoFacScale.c_str()));
+  pt->AddText(Form("%s", infoProcess.c_str()));
+  pt->AddText(Form("pt binning of the spectra: %s", ptBinningName.c_str()));
+  if(useCampaignSeed)
+    pt->AddText(Form("Campaign seed = %llu, task = %ld (seeds per pTHat bin and thread from Get_Stream_Seed, bin 0: %ld)", campaignSeed, campaignTask, Get_Stream_Seed(0, 0)));
+  else
+    pt->AddText(Form("Random seed = %d", p.settings.mode("Random:seed")));
+  if( getenv("EVENTSEEDS") && strcmp(getenv("EVENTSEEDS"),"0") ) pt->AddText("Per-event seeds derived from the seed of the pTHat bin");
+  pt->AddText("Check other READMEs for additional processes that may have been included by merging.");
+  pt->Draw();
+  {
+    std::lock_guard<std::mutex> lock(outputMutex);
+    c->Write();
+  }
+
+  return;
+}
+
+//----------------------------------------------------------------------
+TH1D* PythiaAnalysisHelper::Book_Generator_Info(const char *name){
+
+  TH1D *h_info = new TH1D(name, "generator info (merge by addition)", 7, 0.5, 7.5);
+  h_info->GetXaxis()->SetBinLabel(1, "sumW");
+  h_info->GetXaxis()->SetBinLabel(2, "sumW2");
+  h_info->GetXaxis()->SetBinLabel(3, "nTried");
+  h_info->GetXaxis()->SetBinLabel(4, "nSelected");
+  h_info->GetXaxis()->SetBinLabel(5, "nAccepted");
+  h_info->GetXaxis()->SetBinLabel(6, "sigmaGen x nTried (pb)");
+  h_info->GetXaxis()->SetBinLabel(7, "sigmaErr^2 x nTried^2 (pb^2)");
+
+  return h_info;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_Generator_Info(TH1D *h_info, const Pythia8::Info &info, double sumW2){
+
+  double nTried = info.nTried();
+  double sigma = info.sigmaGen()*1e9; // cross section in picobarn
+  double sigmaErr = info.sigmaErr()*1e9;
+
+  h_info->SetBinContent(1, h_info->GetBinContent(1) + info.weightSum());
+  h_info->SetBinContent(2, h_info->GetBinContent(2) + sumW2);
+  h_info->SetBinContent(3, h_info->GetBinContent(3) + nTried);
+  h_info->SetBinContent(4, h_info->GetBinContent(4) + info.nSelected());
+  h_info->SetBinContent(5, h_info->GetBinContent(5) + info.nAccepted());
+  h_info->SetBinContent(6, h_info->GetBinContent(6) + sigma*nTried);
+  h_info->SetBinContent(7, h_info->GetBinContent(7) + sigmaErr*sigmaErr*nTried*nTried);
+
+  return;
+}
+
+//----------------------------------------------------------------------
+double PythiaAnalysisHelper::Get_SigmaGen(TH1 *h_info){
+  if( h_info->GetBinContent(3) <= 0. ) return 0.;
+  return h_info->GetBinContent(6)/h_info->GetBinContent(3);
+}
+
+//----------------------------------------------------------------------
+double PythiaAnalysisHelper::Get_SigmaErr(TH1 *h_info){
+  if( h_info->GetBinContent(3) <= 0. ) return 0.;
+  return TMath::Sqrt(h_info->GetBinContent(7))/h_info->GetBinContent(3);
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Write_Checkpoint(Pythia8::Pythia &p, const char *fileName, const char *runID, int iBin, int iEvent, TH1D *h_info, double sumW2){
+
+  // at most one snapshot in memory: wait for the previous checkpoint
+  Flush_Writer();
+
+  // random state via Pythia's dump file, stored hex encoded
+  TString tmpName = Form("%s.tmp", fileName);
+  if( !p.rndm.dumpState(tmpName.Data()) ){
+    printf("Write_Checkpoint: could not dump the random state\n");
+    return false;
+  }
+  std::ifstream dump(tmpName.Data(), std::ios::binary);
+  std::ostringstream hex;
+  char c;
+  while( dump.get(c) ) hex << Form("%02x", (unsigned char)c);
+  dump.close();
+
+  // generator info of the running bin incl. the events generated so far
+  double info[7];
+  if(h_info){
+    for(int i = 0; i < 7; i++) info[i] = h_info->GetBinContent(i+1);
+    Fill_Generator_Info(h_info, p.info, sumW2);
+  }
+
+  // snapshot: detached copies, the histograms in memory go on being filled while the copies are written
+  std::vector< std::pair<string, TObject*> > snapshot;
+  bool status = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  TIter next(gROOT->GetList());
+  TObject *obj;
+  while( (obj = next()) )
+    if( obj->InheritsFrom(TH1::Class()) ) snapshot.push_back(std::make_pair(string(obj->GetName()), obj->Clone()));
+  TH1::AddDirectory(status);
+
+  std::map<const TH1*, InvXsecMoments>::iterator it;
+  for(it = map_invXsecMoments.begin(); it != map_invXsecMoments.end(); ++it){
+    snapshot.push_back(std::make_pair(string(Form("checkpoint_sumInvPt_%s", it->first->GetName())),
+				      new TVectorD(it->second.sumInvPt.size(), it->second.sumInvPt.data())));
+    snapshot.push_back(std::make_pair(string(Form("checkpoint_sumInvPt2_%s", it->first->GetName())),
+				      new TVectorD(it->second.sumInvPt2.size(), it->second.sumInvPt2.data())));
+  }
+
+  snapshot.push_back(std::make_pair(string("checkpoint_runID"), new TObjString(runID)));
+  snapshot.push_back(std::make_pair(string("checkpoint_random"), new TObjString(hex.str().c_str())));
+  snapshot.push_back(std::make_pair(string("checkpoint_iBin"), new TParameter<int>("checkpoint_iBin", iBin)));
+  snapshot.push_back(std::make_pair(string("checkpoint_iEvent"), new TParameter<int>("checkpoint_iEvent", iEvent)));
+
+  if(h_info)
+    for(int i = 0; i < 7; i++) h_info->SetBinContent(i+1, info[i]);
+
+  Submit_Checkpoint(snapshot, tmpName.Data(), fileName, iBin, iEvent);
+  return true;
+}
+
+//----------------------------------------------------------------------
+// the snapshot is written to tmp and renamed to target, its objects are deleted by the writer
+void PythiaAnalysisHelper::Submit_Checkpoint(std::vector< std::pair<string, TObject*> > &snapshot, string tmp, string target, int iBin, int iEvent){
+
+  Submit_Write_Job([snapshot, tmp, target, iBin, iEvent](){
+      TFile *file = TFile::Open(tmp.c_str(), "RECREATE");
+      bool success = file && !file->IsZombie();
+      if(!success) printf("Write_Checkpoint: could not create %s\n", tmp.c_str());
+      for(unsigned int i = 0; i < snapshot.size(); i++){
+	if(success) file->WriteTObject(snapshot.at(i).second, snapshot.at(i).first.c_str());
+	delete snapshot.at(i).second;
+      }
+      if(success) file->Close();
+      delete file;
+      if( success && rename(tmp.c_str(), target.c_str()) ){
+	printf("Write_Checkpoint: could not rename %s to %s\n", tmp.c_str(), target.c_str());
+	success = false;
+      }
+      if(success) printf("checkpoint written to %s (pTHat bin %d, %d events)\n", target.c_str(), iBin, iEvent);
+    });
+  return;
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Read_Checkpoint(const char *fileName, const char *runID, int &iBin, int &iEvent){
+
+  TFile *file = TFile::Open(fileName);
+  if( !file || file->IsZombie() ){
+    delete file;
+    return false;
+  }
+  TObjString *id = (TObjString*)file->Get("checkpoint_runID");
+  TObjString *random = (TObjString*)file->Get("checkpoint_random");
+  TParameter<int> *parBin = (TParameter<int>*)file->Get("checkpoint_iBin");
+  TParameter<int> *parEvent = (TParameter<int>*)file->Get("checkpoint_iEvent");
+  if( !id || !random || !parBin || !parEvent || id->String() != runID ){
+    printf("Read_Checkpoint: %s does not belong to this run, starting from scratch\n", fileName);
+    file->Close();
+    delete file;
+    return false;
+  }
+  iBin = parBin->GetVal();
+  iEvent = parEvent->GetVal();
+  checkpointRandomState = random->String().Data();
+
+  // histograms are matched by name, their contents replaced
+  bool status = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  std::vector <TH1*> histos;
+  TIter next(gROOT->GetList());
+  TObject *obj;
+  while( (obj = next()) )
+    if( obj->InheritsFrom(TH1::Class()) ) histos.push_back((TH1*)obj);
+  for(unsigned int i = 0; i < histos.size(); i++){
+    TH1 *saved = (TH1*)file->Get(histos.at(i)->GetName());
+    if(!saved) continue;
+    histos.at(i)->Reset();
+    histos.at(i)->Add(saved);
+    delete saved;
+  }
+
+  std::map<const TH1*, InvXsecMoments>::iterator it;
+  for(it = map_invXsecMoments.begin(); it != map_invXsecMoments.end(); ++it){
+    TVectorD *sumInvPt = (TVectorD*)file->Get(Form("checkpoint_sumInvPt_%s", it->first->GetName()));
+    TVectorD *sumInvPt2 = (TVectorD*)file->Get(Form("checkpoint_sumInvPt2_%s", it->first->GetName()));
+    if( sumInvPt && sumInvPt2 ){
+      it->second.sumInvPt.assign(sumInvPt->GetMatrixArray(), sumInvPt->GetMatrixArray() + sumInvPt->GetNrows());
+      it->second.sumInvPt2.assign(sumInvPt2->GetMatrixArray(), sumInvPt2->GetMatrixArray() + sumInvPt2->GetNrows());
+    }
+    delete sumInvPt;
+    delete sumInvPt2;
+  }
+  TH1::AddDirectory(status);
+
+  file->Close();
+  delete file;
+  printf("resuming from checkpoint %s (pTHat bin %d, %d events)\n", fileName, iBin, iEvent);
+  return true;
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Restore_Random_State(Pythia8::Pythia &p){
+
+  if( checkpointRandomState.empty() ) return false;
+  string tmpName = Form("random_state_%d.tmp", (int)getpid());
+  std::ofstream dump(tmpName.c_str(), std::ios::binary);
+  for(unsigned int i = 0; i+1 < checkpointRandomState.size(); i += 2)
+    dump.put((char)strtol(checkpointRandomState.substr(i, 2).c_str(), NULL, 16));
+  dump.close();
+  bool success = p.rndm.readState(tmpName);
+  remove(tmpName.c_str());
+  if(!success) printf("Restore_Random_State: could not read the random state\n");
+  return success;
+}
+
+//----------------------------------------------------------------------
+static volatile sig_atomic_t stopSignal = 0;
+static void Handle_Stop_Signal(int sig){ stopSignal = sig; }
+
+bool PythiaAnalysisHelper::Set_Deadline(){
+
+  if( !getenv("DEADLINE") ) return false;
+  long seconds = strtol(getenv("DEADLINE"), NULL, 10);
+  deadline = seconds > 0 ? time(0) + seconds : 0;
+  binDeadline = deadline;
+  signal(SIGTERM, Handle_Stop_Signal);
+  signal(SIGUSR1, Handle_Stop_Signal);
+  signal(SIGUSR2, Handle_Stop_Signal);
+  if(deadline) printf("\nGeneration ends gracefully after %ld s or on SIGTERM/SIGUSR1/SIGUSR2\n", seconds);
+  else printf("\nGeneration ends gracefully on SIGTERM/SIGUSR1/SIGUSR2\n");
+  return true;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Start_Deadline_Bin(int nBinsLeft){
+
+  if( !deadline || nBinsLeft < 1 ) return;
+  time_t now = time(0);
+  binDeadline = now + (deadline > now ? (deadline - now)/nBinsLeft : 0);
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_Deadline_Reached(){
+
+  if( stopSignal ) return true;
+  return deadline && time(0) >= binDeadline;
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_Stop_Requested(){
+
+  if( stopSignal ){
+    printf("received signal %d, ending the generation\n", (int)stopSignal);
+    return true;
+  }
+  return deadline && time(0) >= deadline;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Start_Writer(){
+
+  if( writerThread.joinable() ) return;
+  ROOT::EnableThreadSafety(); // main thread and writer use ROOT I/O at the same time
+  writerStop = false;
+  writerThread = std::thread(&PythiaAnalysisHelper::Run_Writer, this);
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Stop_Writer(){
+
+  if( !writerThread.joinable() ) return;
+  {
+    std::lock_guard<std::mutex> lock(writerMutex);
+    writerStop = true;
+  }
+  writerCond.notify_all();
+  writerThread.join();
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Flush_Writer(){
+
+  std::unique_lock<std::mutex> lock(writerMutex);
+  writerCond.wait(lock, [this](){ return writerQueue.empty() && !writerBusy; });
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Submit_Write_Job(std::function<void()> job, long bytes){
+
+  if( !writerThread.joinable() ){
+    job();
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(writerMutex);
+    writerQueue.push_back(std::make_pair(job, bytes));
+  }
+  writerCond.notify_all();
+  return;
+}
+
+//----------------------------------------------------------------------
+// called before the copy is made, so at most writerQueueMaxBytes (or one larger object) are held twice
+void PythiaAnalysisHelper::Reserve_Writer_Queue(long bytes){
+
+  if( !writerThread.joinable() ) return;
+  std::unique_lock<std::mutex> lock(writerMutex);
+  writerCond.wait(lock, [this, bytes](){ return writerQueueBytes == 0 || writerQueueBytes + bytes <= writerQueueMaxBytes; });
+  writerQueueBytes += bytes;
+  return;
+}
+
+//----------------------------------------------------------------------
+// jobs are done in order of submission; the queue is emptied before the thread ends
+void PythiaAnalysisHelper::Run_Writer(){
+
+  std::unique_lock<std::mutex> lock(writerMutex);
+  while(true){
+    writerCond.wait(lock, [this](){ return writerStop || !writerQueue.empty(); });
+    if( writerQueue.empty() ) break;
+    std::function<void()> job = writerQueue.front().first;
+    long bytes = writerQueue.front().second;
+    writerQueue.pop_front();
+    writerBusy = true;
+    lock.unlock();
+    {
+      std::lock_guard<std::mutex> output(outputMutex);
+      job();
+    }
+    lock.lock();
+    writerBusy = false;
+    writerQueueBytes -= bytes;
+    writerCond.notify_all();
+  }
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Write_Async(TDirectory *dir, const TObject *obj){
+
+  if( !writerThread.joinable() ){
+    dir->WriteTObject(obj);
+    return;
+  }
+  long bytes = 0;
+  if( obj->InheritsFrom(TH1::Class()) ){
+    const TH1 *h = (const TH1*)obj;
+    bytes = h->GetNcells()*sizeof(double)*(h->GetSumw2N() ? 2 : 1);
+  }
+  Reserve_Writer_Queue(bytes);
+  bool status = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  TObject *copy = obj->Clone();
+  TH1::AddDirectory(status);
+  Submit_Write_Job([dir, copy](){
+      dir->WriteTObject(copy);
+      delete copy;
+    }, bytes);
+  return;
+}
+
+//----------------------------------------------------------------------
+TDirectory* PythiaAnalysisHelper::Mkdir_Output(TDirectory *mother, const char *name){
+
+  std::lock_guard<std::mutex> lock(outputMutex);
+  return mother->mkdir(name);
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Get_Event_Info(Pythia8::Pythia &p, EventInfo &info){
+
+  info.pTHat = p.info.pTHat();
+  info.x1 = p.info.x1();
+  info.x2 = p.info.x2();
+  info.eB = p.info.eB();
+  info.weights.resize(p.info.nWeights());
+  for(int i = 0; i < p.info.nWeights(); i++) info.weights.at(i) = p.info.weight(i);
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Set_Store_Branches(TTree *tree, bool isWriting){
+
+  if(isWriting){
+    tree->Branch("iBin", &stored->iBin, "iBin/I");
+    tree->Branch("pTHat", &stored->pTHat, "pTHat/F");
+    tree->Branch("x1", &stored->x1, "x1/F");
+    tree->Branch("x2", &stored->x2, "x2/F");
+    tree->Branch("eB", &stored->eB, "eB/F");
+    tree->Branch("nWeights", &stored->nWeights, "nWeights/I");
+    tree->Branch("weights", stored->weights, "weights[nWeights]/F");
+    tree->Branch("nPart", &stored->nPart, "nPart/I");
+    tree->Branch("id", stored->id, "id[nPart]/I");
+    tree->Branch("status", stored->status, "status[nPart]/S");
+    tree->Branch("mother1", stored->mother1, "mother1[nPart]/I");
+    tree->Branch("mother2", stored->mother2, "mother2[nPart]/I");
+    tree->Branch("statusTopCopy", stored->statusTopCopy, "statusTopCopy[nPart]/S");
+    tree->Branch("pT", stored->pT, "pT[nPart]/F");
+    tree->Branch("eta", stored->eta, "eta[nPart]/F");
+    tree->Branch("phi", stored->phi, "phi[nPart]/F");
+    tree->Branch("m", stored->m, "m[nPart]/F");
+    return;
+  }
+  tree->SetBranchAddress("iBin", &stored->iBin);
+  tree->SetBranchAddress("pTHat", &stored->pTHat);
+  tree->SetBranchAddress("x1", &stored->x1);
+  tree->SetBranchAddress("x2", &stored->x2);
+  tree->SetBranchAddress("eB", &stored->eB);
+  tree->SetBranchAddress("nWeights", &stored->nWeights);
+  tree->SetBranchAddress("weights", stored->weights);
+  tree->SetBranchAddress("nPart", &stored->nPart);
+  tree->SetBranchAddress("id", stored->id);
+  tree->SetBranchAddress("status", stored->status);
+  tree->SetBranchAddress("mother1", stored->mother1);
+  tree->SetBranchAddress("mother2", stored->mother2);
+  tree->SetBranchAddress("statusTopCopy", stored->statusTopCopy);
+  tree->SetBranchAddress("pT", stored->pT);
+  tree->SetBranchAddress("eta", stored->eta);
+  tree->SetBranchAddress("phi", stored->phi);
+  tree->SetBranchAddress("m", stored->m);
+  return;
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Open_Event_Store(const char *fileName, double etaMax){
+
+  storeFile = TFile::Open(fileName, "RECREATE");
+  if( !storeFile || storeFile->IsZombie() ){
+    printf("Open_Event_Store: could not create %s\n", fileName);
+    delete storeFile;
+    storeFile = 0;
+    return false;
+  }
+  storeFile->SetCompressionSettings(ROOT::CompressionSettings(ROOT::kLZ4, 4)); // fast decompression for the replays
+  if(!stored) stored = new StoredEvent;
+  storeTree = new TTree("events", "particle-level event store of PythiaAnalysis");
+  storeTree->SetAutoFlush(1000);
+  Set_Store_Branches(storeTree, true);
+  storeEtaMax = etaMax;
+  gROOT->cd();
+  return true;
+}
+
+//----------------------------------------------------------------------
+// particles of the analysis: final ones and the mesons of the spectra (also filled if decayed)
+// + for each stored particle its top copy, else its top copy with the same id, else its mother, up to three levels
+void PythiaAnalysisHelper::Store_Event(Pythia8::Event &event, EventInfo &info, int iBin){
+
+  if(!storeTree) return;
+  int n = event.size();
+  std::vector<int> depth(n, -1), link(n, 0), queue;
+  for(int i = 0; i < n && i < 5; i++) depth.at(i) = 3; // system, beams and incoming partons at their indices, no links
+  for(int i = 5; i < n; i++){
+    int id = event[i].id();
+    if( !event[i].isFinal() && id != 111 && id != 221 && id != 331 && id != 223 ) continue;
+    if( storeEtaMax >= 0. && TMath::Abs(event[i].eta()) > storeEtaMax ) continue;
+    depth.at(i) = 0;
+    queue.push_back(i);
+  }
+  for(unsigned int q = 0; q < queue.size(); q++){
+    int i = queue.at(q);
+    int iUp = event[i].iTopCopy();
+    if( iUp == i ) iUp = event[i].iTopCopyId();
+    if( iUp == i ) iUp = event[i].mother1();
+    link.at(i) = iUp;
+    if( iUp > 0 && depth.at(iUp) < 0 && depth.at(i) < 3 ){
+      depth.at(iUp) = depth.at(i) + 1;
+      queue.push_back(iUp);
+    }
+  }
+
+  // stored in the original order, links re-indexed
+  std::vector<int> index(n, 0);
+  int nPart = 0;
+  for(int i = 0; i < n; i++)
+    if( depth.at(i) >= 0 ) index.at(i) = nPart++;
+  if( nPart > maxStoredParticles ){
+    printf("Store_Event: %d particles, only %d can be stored. Event skipped\n", nPart, maxStoredParticles);
+    return;
+  }
+
+  stored->iBin = iBin;
+  stored->pTHat = info.pTHat;
+  stored->x1 = info.x1;
+  stored->x2 = info.x2;
+  stored->eB = info.eB;
+  stored->nWeights = TMath::Min((int)info.weights.size(), maxStoredWeights);
+  for(int i = 0; i < stored->nWeights; i++) stored->weights[i] = info.weights.at(i);
+  stored->nPart = nPart;
+  for(int i = 0; i < n; i++){
+    if( depth.at(i) < 0 ) continue;
+    int k = index.at(i);
+    int iUp = link.at(i);
+    bool isLinked = i >= 5 && iUp > 0 && depth.at(iUp) >= 0;
+    stored->id[k] = event[i].id();
+    stored->status[k] = event[i].status();
+    // carbon copy: mother1 = mother2 = top copy; otherwise mother2 = 0 ends the iTopCopy() search
+    stored->mother1[k] = i < 5 ? event[i].mother1() : (isLinked ? index.at(iUp) : 0);
+    stored->mother2[k] = i < 5 ? event[i].mother2() : (isLinked && iUp == event[i].iTopCopy() ? index.at(iUp) : 0);
+    stored->statusTopCopy[k] = event[event[i].iTopCopy()].status();
+    stored->pT[k] = event[i].pT();
+    stored->eta[k] = event[i].pT() > 0. ? event[i].eta() : event[i].pz(); // pT = 0 (beams): pz instead of eta
+    stored->phi[k] = event[i].phi();
+    stored->m[k] = event[i].m();
+  }
+  storeTree->Fill();
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Close_Event_Store(std::vector <TH1D*> &vec_genInfo){
+
+  if(!storeFile) return;
+  storeFile->cd();
+  storeTree->Write();
+  for(unsigned int i = 0; i < vec_genInfo.size(); i++) vec_genInfo.at(i)->Write();
+  printf("%lld events stored in %s\n", storeTree->GetEntries(), storeFile->GetName());
+  storeFile->Close();
+  delete storeFile;
+  storeFile = 0;
+  storeTree = 0;
+  gROOT->cd();
+  return;
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Open_Replay(const char *fileNames, int iChunk, int nChunks){
+
+  if( iChunk < 0 || iChunk >= nChunks ){
+    printf("Open_Replay: chunk %d of %d does not exist\n", iChunk, nChunks);
+    return false;
+  }
+  replayChain = new TChain("events");
+  if( !replayChain->Add(fileNames) || replayChain->GetEntries() <= 0 ){
+    printf("Open_Replay: no stored events in %s\n", fileNames);
+    return false;
+  }
+  if(!stored) stored = new StoredEvent;
+
+  // entry ranges per pTHat bin from the bin branch alone
+  Int_t iBin;
+  replayChain->SetBranchStatus("*", 0);
+  replayChain->SetBranchStatus("iBin", 1);
+  replayChain->SetBranchAddress("iBin", &iBin);
+  Long64_t nEntries = replayChain->GetEntries();
+  for(Long64_t i = 0; i < nEntries; i++){
+    replayChain->GetEntry(i);
+    if( iBin < 0 ) continue;
+    if( (int)replayRanges.size() <= iBin ) replayRanges.resize(iBin+1);
+    std::vector< std::pair<Long64_t,Long64_t> > &ranges = replayRanges.at(iBin);
+    if( ranges.size() && ranges.back().second == i ) ranges.back().second = i+1;
+    else ranges.push_back(std::make_pair(i, i+1));
+  }
+  replayChain->SetBranchStatus("*", 1);
+  Set_Store_Branches(replayChain, false);
+
+  int nBins = replayRanges.size();
+  replayBinEvents.assign(nBins, 0);
+  replayFirst.assign(nBins, 0);
+  replayNext.assign(nBins, 0);
+  replayEnd.assign(nBins, 0);
+  for(int i = 0; i < nBins; i++){
+    for(unsigned int j = 0; j < replayRanges.at(i).size(); j++)
+      replayBinEvents.at(i) += replayRanges.at(i).at(j).second - replayRanges.at(i).at(j).first;
+    replayFirst.at(i) = replayBinEvents.at(i)*iChunk/nChunks;
+    replayNext.at(i) = replayFirst.at(i);
+    replayEnd.at(i) = replayBinEvents.at(i)*(iChunk+1)/nChunks;
+  }
+  printf("replaying chunk %d of %d of %lld stored events from %s\n", iChunk, nChunks, nEntries, fileNames);
+  return true;
+}
+
+//----------------------------------------------------------------------
+int PythiaAnalysisHelper::Get_Replay_Events(int iBin){
+
+  if( iBin < 0 || iBin >= (int)replayEnd.size() ) return 0;
+  return replayEnd.at(iBin) - replayFirst.at(iBin);
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Next_Replay_Event(Pythia8::Event &event, EventInfo &info, int iBin){
+
+  if( iBin < 0 || iBin >= (int)replayEnd.size() || replayNext.at(iBin) >= replayEnd.at(iBin) ) return false;
+
+  // event number in the bin -> entry
+  Long64_t iEvent = replayNext.at(iBin)++;
+  std::vector< std::pair<Long64_t,Long64_t> > &ranges = replayRanges.at(iBin);
+  unsigned int j = 0;
+  while( iEvent >= ranges.at(j).second - ranges.at(j).first ){
+    iEvent -= ranges.at(j).second - ranges.at(j).first;
+    j++;
+  }
+  if( replayChain->GetEntry(ranges.at(j).first + iEvent) <= 0 ) return false;
+
+  info.pTHat = stored->pTHat;
+  info.x1 = stored->x1;
+  info.x2 = stored->x2;
+  info.eB = stored->eB;
+  info.weights.assign(stored->weights, stored->weights + stored->nWeights);
+
+  event.reset();
+  for(int k = 0; k < stored->nPart; k++){
+    double px = stored->pT[k]*TMath::Cos(stored->phi[k]);
+    double py = stored->pT[k]*TMath::Sin(stored->phi[k]);
+    double pz = stored->pT[k] > 0. ? stored->pT[k]*TMath::SinH(stored->eta[k]) : stored->eta[k];
+    double e = TMath::Sqrt(px*px + py*py + pz*pz + stored->m[k]*stored->m[k]);
+    event.append(stored->id[k], stored->status[k], stored->mother1[k], stored->mother2[k], 0, 0, 0, 0, px, py, pz, e, stored->m[k]);
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Get_Replay_Generator_Info(int iBin, TH1D *h_info){
+
+  if( !replayChain || iBin < 0 || iBin >= (int)replayBinEvents.size() || replayBinEvents.at(iBin) <= 0 ) return;
+  // events analysed in this chunk, i.e. less if the bin was closed early
+  double fraction = (double)(replayNext.at(iBin) - replayFirst.at(iBin))/replayBinEvents.at(iBin);
+
+  // summed over the files of the chain
+  TIter next(replayChain->GetListOfFiles());
+  TObject *element;
+  while( (element = next()) ){
+    TFile *file = TFile::Open(element->GetTitle());
+    if( !file || file->IsZombie() ){
+      delete file;
+      continue;
+    }
+    TH1 *h = (TH1*)file->Get(h_info->GetName());
+    if(h)
+      for(int i = 1; i <= h_info->GetNbinsX(); i++) h_info->SetBinContent(i, h_info->GetBinContent(i) + fraction*h->GetBinContent(i));
+    delete h;
+    file->Close();
+    delete file;
+  }
+  gROOT->cd();
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Close_Replay(){
+
+  delete replayChain;
+  replayChain = 0;
+  replayRanges.clear();
+  return;
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Open_Weight_Log(const char *fileName){
+
+  weightLogFile = TFile::Open(fileName, "RECREATE");
+  if( !weightLogFile || weightLogFile->IsZombie() ){
+    printf("Open_Weight_Log: could not create %s\n", fileName);
+    delete weightLogFile;
+    weightLogFile = 0;
+    return false;
+  }
+  if(!weightLogEntry) weightLogEntry = new WeightLogEntry;
+  weightLogTree = new TTree("weightLog", "per-event weights");
+  weightLogTree->Branch("iEvent", &weightLogEntry->iEvent, "iEvent/L");
+  weightLogTree->Branch("iBin", &weightLogEntry->iBin, "iBin/I");
+  weightLogTree->Branch("pTHat", &weightLogEntry->pTHat, "pTHat/F");
+  weightLogTree->Branch("uborns", &weightLogEntry->uborns, "uborns/F");
+  weightLogTree->Branch("photonPt", &weightLogEntry->photonPt, "photonPt/F");
+  weightLogTree->Branch("nWeights", &weightLogEntry->nWeights, "nWeights/I");
+  weightLogTree->Branch("weights", weightLogEntry->weights, "weights[nWeights]/D"); // double for exact cross section corrections
+  weightLogTree->Branch("seed", &weightLogEntry->seed, "seed/L");
+  weightLogTree->Branch("vetoed", &weightLogEntry->vetoed, "vetoed/O");
+  gROOT->cd();
+  return true;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Log_Event_Weights(Long64_t iEvent, int iBin, double pTHat, double uborns, double photonPt, const std::vector<double> &weights, Long64_t seed, bool vetoed){
+
+  if(!weightLogTree) return;
+  weightLogEntry->iEvent = iEvent;
+  weightLogEntry->iBin = iBin;
+  weightLogEntry->pTHat = pTHat;
+  weightLogEntry->uborns = uborns;
+  weightLogEntry->photonPt = photonPt;
+  weightLogEntry->nWeights = TMath::Min((int)weights.size(), maxStoredWeights);
+  for(int i = 0; i < weightLogEntry->nWeights; i++) weightLogEntry->weights[i] = weights.at(i);
+  weightLogEntry->seed = seed;
+  weightLogEntry->vetoed = vetoed;
+  weightLogTree->Fill();
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Close_Weight_Log(){
+
+  if(!weightLogFile) return;
+  weightLogFile->cd();
+  weightLogTree->Write();
+  weightLogFile->Close();
+  delete weightLogFile;
+  weightLogFile = 0;
+  weightLogTree = 0;
+  gROOT->cd();
+  return;
+}
+
+//----------------------------------------------------------------------
+double PythiaAnalysisHelper::Get_Leading_Direct_Photon_Pt(Pythia8::Event &event, float etaMax){
+
+  double ptMax = -1.;
+  for (int i = 5; i < event.size(); i++)
+    if( Is_Direct_Photon(event, i) && TMath::Abs(event[i].eta()) < etaMax && event[i].pT() > ptMax ) ptMax = event[i].pT();
+  return ptMax;
+}
+
+//----------------------------------------------------------------------
+long PythiaAnalysisHelper::Get_Event_Seed(long jobSeed, int iBin, long iEvent){
+
+  unsigned long long x = Mix_Seed( Mix_Seed( Mix_Seed((unsigned long long)jobSeed) + (unsigned long long)iBin ) + (unsigned long long)iEvent );
+  return 1 + (long)(x % 900000000ULL); // 0 would mean a time dependent seed in Pythia
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Reseed_Event(Pythia8::Pythia &p, long eventSeed){
+
+  p.rndm.init(eventSeed);
+  return;
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Read_Event_List(const char *fileName, std::map<int, std::map<long,long> > &events){
+
+  std::ifstream list(fileName);
+  if( !list.good() ){
+    printf("Read_Event_List: could not open %s\n", fileName);
+    return false;
+  }
+  string line;
+  int nEvents = 0;
+  while( std::getline(list, line) ){
+    if( line.empty() || line[0] == '#' ) continue;
+    std::istringstream fields(line);
+    int iBin;
+    long iEvent, seed;
+    if( !(fields >> iBin >> iEvent >> seed) ){
+      printf("Read_Event_List: skipping line \"%s\" (expected \"iBin iEvent seed\")\n", line.c_str());
+      continue;
+    }
+    if( seed <= 0 ){
+      printf("Read_Event_List: no per-event seed in line \"%s\", the job has to run with EVENTSEEDS=1 to regenerate its events\n", line.c_str());
+      return false;
+    }
+    events[iBin][iEvent] = seed;
+    nEvents++;
+  }
+  printf("Read_Event_List: %d events in %lu pTHat bins from %s\n", nEvents, events.size(), fileName);
+  return nEvents > 0;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Start_Timing_Bin(int iBin){
+
+  if(!useTiming) return;
+  Close_Timing_Bin();
+  TimingBin bin = {};
+  bin.iBin = iBin;
+  timingBins.push_back(bin);
+  nTimedEvents = nScannedParticles = nHistoFills = nIsoQueries = 0;
+  timingBinStart = std::chrono::steady_clock::now();
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Close_Timing_Bin(){
+
+  if( !timingBins.size() ) return;
+  TimingBin &bin = timingBins.back();
+  bin.wallTime    = std::chrono::duration<double>(std::chrono::steady_clock::now() - timingBinStart).count();
+  bin.nEvents     = nTimedEvents;
+  bin.nParticles  = nScannedParticles;
+  bin.nFills      = nHistoFills;
+  bin.nIsoQueries = nIsoQueries;
+  return;
+}
+
+//----------------------------------------------------------------------
+// the counters are read closest to the code of the stage
+void PythiaAnalysisHelper::Start_Stage(int stage){
+
+  stageStart[stage] = std::chrono::steady_clock::now();
+  if(usePerf) Read_Perf_Counters(perfStart[stage]);
+  return;
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Stop_Stage(int stage){
+
+  unsigned long long perfStop[nPerfCounters];
+  bool isRead = usePerf && Read_Perf_Counters(perfStop);
+  if( !timingBins.size() ) return;
+  TimingBin &bin = timingBins.back();
+  bin.seconds[stage] += std::chrono::duration<double>(std::chrono::steady_clock::now() - stageStart[stage]).count();
+  bin.calls[stage]++;
+  if(isRead)
+    for(int i = 0; i < nPerfCounters; i++)
+      if( perfStop[i] > perfStart[stage][i] ) bin.perf[stage][i] += perfStop[i] - perfStart[stage][i];
+  return;
+}
+
+//----------------------------------------------------------------------
+// one group of counters for the calling (main) thread, user space only, so the default perf_event_paranoid = 2 is enough
+bool PythiaAnalysisHelper::Enable_Perf_Counters(){
+
+#ifdef __linux__
+  const unsigned long long configs[nPerfCounters] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                     PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+  for(int i = 0; i < nPerfCounters; i++){
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = configs[i];
+    attr.disabled = i == 0; // the group is enabled through its leader
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    perfFd[i] = syscall(__NR_perf_event_open, &attr, 0, -1, i ? perfFd[0] : -1, 0);
+    if( perfFd[i] < 0 ){
+      printf("Enable_Perf_Counters: perf_event_open failed for counter %d (%s), see /proc/sys/kernel/perf_event_paranoid; timing without counters\n", i, strerror(errno));
+      for(int j = 0; j < i; j++){
+        close(perfFd[j]);
+        perfFd[j] = -1;
+      }
+      return false;
+    }
+  }
+  ioctl(perfFd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(perfFd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  usePerf = true;
+  printf("\nHardware counters (cycles, instructions, cache misses, branch misses) per stage enabled\n");
+  return true;
+#else
+  printf("Enable_Perf_Counters: hardware counters need Linux (perf_event_open); timing without counters\n");
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Read_Perf_Counters(unsigned long long *values){
+
+#ifdef __linux__
+  unsigned long long data[3+nPerfCounters]; // number of counters, time enabled, time running, values
+  if( read(perfFd[0], data, sizeof(data)) != (ssize_t)sizeof(data) ) return false;
+  double scale = data[2] > 0 ? double(data[1])/data[2] : 0.;
+  for(int i = 0; i < nPerfCounters; i++) values[i] = (unsigned long long)(data[3+i]*scale);
+  return true;
+#else
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Write_Timing(TFile &file){
+
+  if( !useTiming || !timingBins.size() ) return;
+  Close_Timing_Bin();
+
+  const char *stageNames[nTimingStages] = {"init", "generation", "gammaJet", "fills", "isolation", "scale", "write"};
+  TimingBin bin;
+  Double_t eventsPerSecond;
+  file.cd();
+  TTree *tree = new TTree("timing", "wall time (s) per stage and pTHat bin");
+  tree->Branch("iBin", &bin.iBin, "iBin/I");
+  tree->Branch("wallTime", &bin.wallTime, "wallTime/D");
+  for(int s = 0; s < nTimingStages; s++){
+    tree->Branch(Form("t_%s", stageNames[s]), &bin.seconds[s], Form("t_%s/D", stageNames[s]));
+    tree->Branch(Form("n_%s", stageNames[s]), &bin.calls[s], Form("n_%s/L", stageNames[s]));
+  }
+  tree->Branch("nEvents", &bin.nEvents, "nEvents/L");
+  tree->Branch("nParticles", &bin.nParticles, "nParticles/L");
+  tree->Branch("nFills", &bin.nFills, "nFills/L");
+  tree->Branch("nIsoQueries", &bin.nIsoQueries, "nIsoQueries/L");
+  tree->Branch("eventsPerSecond", &eventsPerSecond, "eventsPerSecond/D");
+  const char *perfNames[nPerfCounters] = {"cycles", "instructions", "cacheMisses", "branchMisses"};
+  if(usePerf)
+    for(int s = 0; s < nTimingStages; s++)
+      for(int i = 0; i < nPerfCounters; i++)
+        tree->Branch(Form("%s_%s", perfNames[i], stageNames[s]), &bin.perf[s][i], Form("%s_%s/L", perfNames[i], stageNames[s]));
+
+  printf("\n--- timing (s) ---\n%5s %10s %9s", "bin", "events", "ev/s");
+  for(int s = 0; s < nTimingStages; s++) printf(" %10s", stageNames[s]);
+  printf(" %10s %12s %12s %10s\n", "wall", "particles", "fills", "isoQueries");
+
+  TimingBin total = {};
+  for(unsigned int i = 0; i <= timingBins.size(); i++){
+    bool isTotal = i == timingBins.size();
+    bin = isTotal ? total : timingBins.at(i);
+    eventsPerSecond = bin.wallTime > 0. ? bin.nEvents/bin.wallTime : 0.;
+    if(!isTotal){
+      tree->Fill();
+      total.wallTime += bin.wallTime;
+      for(int s = 0; s < nTimingStages; s++){
+        total.seconds[s] += bin.seconds[s];
+        total.calls[s]   += bin.calls[s];
+      }
+      total.nEvents     += bin.nEvents;
+      total.nParticles  += bin.nParticles;
+      total.nFills      += bin.nFills;
+      total.nIsoQueries += bin.nIsoQueries;
+      for(int s = 0; s < nTimingStages; s++)
+        for(int c = 0; c < nPerfCounters; c++) total.perf[s][c] += bin.perf[s][c];
+      printf("%5d", bin.iBin);
+    }
+    else printf("%5s", "all");
+    printf(" %10lld %9.1f", bin.nEvents, eventsPerSecond);
+    for(int s = 0; s < nTimingStages; s++) printf(" %10.2f", bin.seconds[s]);
+    printf(" %10.2f %12lld %12lld %10lld\n", bin.wallTime, bin.nParticles, bin.nFills, bin.nIsoQueries);
+  }
+
+  // hardware counters per bin and stage: IPC < 1 with many cache misses per 1000 instructions points to memory-bound code
+  if(usePerf){
+    printf("\n--- hardware counters of the main thread ---\n%5s %-10s %10s %12s %6s %16s %17s\n",
+           "bin", "stage", "calls", "Mcycles", "IPC", "cacheMiss/kInstr", "branchMiss/kInstr");
+    for(unsigned int i = 0; i <= timingBins.size(); i++){
+      bool isTotal = i == timingBins.size();
+      const TimingBin &row = isTotal ? total : timingBins.at(i);
+      for(int s = 0; s < nTimingStages; s++){
+        if( !row.calls[s] ) continue;
+        double kInstr = row.perf[s][1]/1000.;
+        printf("%5s %-10s %10lld %12.1f %6.2f %16.2f %17.2f\n", isTotal ? "all" : Form("%d", row.iBin), stageNames[s], row.calls[s],
+               row.perf[s][0]/1e6, row.perf[s][0] > 0 ? row.perf[s][1]/double(row.perf[s][0]) : 0.,
+               kInstr > 0. ? row.perf[s][2]/kInstr : 0., kInstr > 0. ? row.perf[s][3]/kInstr : 0.);
+      }
     }
-    else
-      printf("\nNo sensible argument argv[5] is given -> full pythia events will be generated (default)\n");
   }
-  
+
+  tree->Write();
+  delete tree;
+  gROOT->cd();
   return;
 }
 
 //----------------------------------------------------------------------
-void PythiaAnalysisHelper::Write_README(Pythia8::Pythia &p, TFile &file, int argc, char **argv, string pdfA, string pdfB, double *pTHatBin){
+bool PythiaAnalysisHelper::Open_Progress(const char *fileName, int interval, long nEventsTotal){
 
-  file.cd();
-  string infoPDFA, infoPDFB, infoEnergyA, infoEnergyB, infoProcess, infoOption, infoRenScale, infoFacScale;
+  if( progressThread.joinable() ) return true;
+  if( interval < 1 ){
+    printf("Open_Progress: interval has to be at least 1 s\n");
+    return false;
+  }
+  progressFile = fopen(fileName, "a");
+  if(!progressFile){
+    printf("Open_Progress: could not open %s\n", fileName);
+    return false;
+  }
+  progressInterval = interval;
+  progressTotal = nEventsTotal;
+  progressStart = time(0);
+  progressStop = false;
+  progressThread = std::thread(&PythiaAnalysisHelper::Run_Progress, this);
+  printf("\nProgress every %d s to %s\n", interval, fileName);
+  return true;
+}
 
-  if( !strcmp(argv[2],"JJ") ) infoProcess = "Using JetJet processes (codes 111-124)";
-  else if( !strcmp(argv[2],"GJ") ) infoProcess = "Using GammaJet processes (codes 201-205)";
-  else if( !strcmp(argv[2],"WeakBoson" ) ) infoProcess = "Using single weak boson production processes (codes 224,225)";
-  else if( !strcmp(argv[2],"MB" ) ) infoProcess = "Using Minimum Bias production processes (codes 101,103-106)";
-  else if( !strcmp(argv[2],"MBVeto" ) ) infoProcess = Form("Using Minimum Bias production processes (codes 101,103-106), but only below pthat = %f GeV, so that other processes can be used for high pt statistics",pTHatBin[0]);
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Progress_Bin(int iBin, long nEventsBin){
 
-  infoEnergyA = Form("%f", p.event[1].e());
-  infoEnergyB = Form("%f", p.event[2].e());
+  progressBinFirst = progressEvents.load();
+  progressBinTotal = nEventsBin;
+  progressBin = iBin;
+  return;
+}
 
-  if( !strcmp(argv[5],"fullEvents") ) infoOption = "Full events have been processed (including hadronization, MPI etc...)";
-  if( !strcmp(argv[5],"fullEventsMonash") ) infoOption = "Full events have been processed (including hadronization, MPI etc...) using the Monash 2013 tune";
-  if( !strcmp(argv[5],"fullEventsTune4C") ) infoOption = "Full events have been processed (including hadronization, MPI etc...) using the Tune 4C";
-  if( !strcmp(argv[5],"noMPI") ) infoOption = "BEWARE: events have been processed without Multiparton Interaction";
-  if( !strcmp(argv[5],"noMPInoHadro") ) infoOption = "BEWARE: events have been processed without Multiparton Interaction and without hadronization";
-  if( !strcmp(argv[5],"noShower") ) infoOption = "BEWARE: events have been processed without any parton shower, only the naked hard process";
-    
-  if( argc >= 7 ) infoRenScale = Form("Using renormalization scale: #mu_{R} = Q^{2} #times %s", argv[6]);
-  else infoRenScale = "Using renormalization scale: #mu^{2}_{R} = Q^{2} #times 1.00";
-  if( argc >= 8 ) infoFacScale = Form("Using factorization scale: #mu_{F} = Q^{2} #times %s", argv[7]);
-  else infoFacScale = "Using factorization scale: #mu^{2}_{F} = Q^{2} #times 1.00";
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Close_Progress(){
 
-  if(argc >= 10) infoPDFA = pdfA;
-  else infoPDFA = "NNPDF2.3 QCD+QED LO";
+  if( !progressThread.joinable() ) return;
+  {
+    std::lock_guard<std::mutex> lock(progressMutex);
+    progressStop = true;
+  }
+  progressCond.notify_all();
+  progressThread.join();
+  fclose(progressFile);
+  progressFile = 0;
+  return;
+}
 
-  if(argc >= 11) infoPDFB = pdfB; 
-  else infoPDFB = "NNPDF2.3 QCD+QED LO";
+//----------------------------------------------------------------------
+// one line per interval, the rate is the one of the last interval (0 if stuck), the projected end uses the average rate
+void PythiaAnalysisHelper::Run_Progress(){
+
+  long lastEvents = progressEvents;
+  time_t lastTime = progressStart;
+  std::unique_lock<std::mutex> lock(progressMutex);
+  while(true){
+    progressCond.wait_for(lock, std::chrono::seconds(progressInterval), [this](){ return progressStop; });
+    time_t now = time(0);
+    long events = progressEvents;
+    double rate = now > lastTime ? (events - lastEvents)/double(now - lastTime) : 0.;
+    Write_Progress_Line(progressStop ? "done" : "running", now, rate);
+    if(progressStop) break;
+    lastEvents = events;
+    lastTime = now;
+  }
+  return;
+}
 
-  TCanvas *c = new TCanvas(Form("README_%s",argv[2]),Form("README_%s",argv[2]));
-  TPaveText *pt = new TPaveText(.01,.01,.99,.99);
-  pt->AddText("Generated with Pythia 8.230 and following config:");
-  pt->AddText(Form("PDF beam A = %s", infoPDFA.c_str()));
-  pt->AddText(Form("PDF beam B = %s", infoPDFB.c_str()));
-  pt->AddText(Form("Energy beam A = %s GeV", infoEnergyA.c_str()));
-  pt->AddText(Form("Energy beam B = %s GeV", infoEnergyB.c_str()));
-  pt->AddText(Form("%s", infoOption.c_str()));
-  pt->AddText(Form("%s", infoRenScale.c_str()));
-  pt->AddText(Form("%s", infoFacScale.c_str()));
-  pt->AddText(Form("%s", infoProcess.c_str()));
-  pt->AddText("Check other READMEs for additional processes that may have been included by merging.");
-  pt->Draw();
-  c->Write();
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Write_Progress_Line(const char *status, time_t now, double rate){
 
+  long events = progressEvents, vetoed = progressVetoed;
+  long binEvents = events - progressBinFirst;
+
+  long projectedEnd = -1;
+  if( !strcmp(status,"done") ) projectedEnd = now;
+  else if( progressTotal > 0 && events > 0 && now > progressStart ){
+    double averageRate = events/double(now - progressStart);
+    projectedEnd = now + (long)((progressTotal - events)/averageRate);
+    if( deadline && projectedEnd > deadline ) projectedEnd = deadline;
+  }
+
+  // resident memory from the second field of /proc/self/statm (pages)
+  double rssMB = -1.;
+  FILE *statm = fopen("/proc/self/statm", "r");
+  if(statm){
+    long size, resident;
+    if( fscanf(statm, "%ld %ld", &size, &resident) == 2 ) rssMB = resident*(double)sysconf(_SC_PAGESIZE)/(1024.*1024.);
+    fclose(statm);
+  }
+  char host[256] = "unknown";
+  gethostname(host, sizeof(host)-1);
+
+  fprintf(progressFile, "time=%ld host=%s pid=%d interval=%d status=%s bin=%d binEvents=%ld binTotal=%ld events=%ld total=%ld rate=%.2f accepted=%.4f eta=%ld rssMB=%.1f\n",
+          (long)now, host, (int)getpid(), progressInterval, status, progressBin.load(), binEvents, progressBinTotal.load(), events, progressTotal,
+          rate, events > 0 ? 1. - vetoed/double(events) : 1., projectedEnd, rssMB);
+  fflush(progressFile);
   return;
 }
 
+//----------------------------------------------------------------------
+long PythiaAnalysisHelper::Count_LHE_Events(const char *fileName){
+
+  std::ifstream lhe(fileName);
+  if( !lhe.good() ){
+    printf("Count_LHE_Events: could not open %s\n", fileName);
+    return -1;
+  }
+  string line;
+  long nEvents = 0;
+  while( std::getline(lhe, line) )
+    if( line.find("<event") != string::npos && line.find("<eventgroup") == string::npos ) nEvents++;
+  return nEvents;
+}
+
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Set_PtBinning(const char *scheme){
+
+  std::vector <double> edges;
+  if( !strcmp(scheme,"default") )          edges.assign(ptBinArray, ptBinArray+ptBins+1);
+  else if( !strcmp(scheme,"Marco") )       edges.assign(ptBinArrayMarco, ptBinArrayMarco+ptBinsMarco+1);
+  else if( !strcmp(scheme,"omega") )       edges.assign(ptBinArrayOmega, ptBinArrayOmega+ptBinsOmega+1);
+  else if( !strcmp(scheme,"eta") )         edges.assign(ptBinArrayEta, ptBinArrayEta+ptBinsEta+1);
+  else if( !strcmp(scheme,"mergedEMCal") ) edges.assign(ptBinArrayMergedEMCal, ptBinArrayMergedEMCal+ptBinsMergedEMCal+1);
+  else{ // comma separated list of edges
+    const char *c = scheme;
+    char *end;
+    while(*c){
+      double edge = strtod(c, &end);
+      if(end == c) break;
+      edges.push_back(edge);
+      c = end;
+      if(*c == ',') c++;
+    }
+    if(*c){
+      printf("Set_PtBinning: unknown pt binning \"%s\"\n", scheme);
+      return false;
+    }
+  }
+
+  if(edges.size() < 2 || edges.size() > (unsigned int)ptBinsFine+1){
+    printf("Set_PtBinning: pt binning \"%s\" needs between 2 and %d edges\n", scheme, ptBinsFine+1);
+    return false;
+  }
+  for(unsigned int i = 0; i < edges.size(); i++){
+    bool isFineEdge = false;
+    for(int j = 0; j <= ptBinsFine; j++)
+      if( TMath::Abs(ptBinArrayFine[j] - edges.at(i)) < 1e-9 ) isFineEdge = true;
+    if( !isFineEdge || (i > 0 && edges.at(i) <= edges.at(i-1)) ){
+      printf("Set_PtBinning: edge %.3f of pt binning \"%s\" is not increasing or not an edge of ptBinArrayFine\n", edges.at(i), scheme);
+      return false;
+    }
+  }
+
+  ptBinsOut = edges.size()-1;
+  std::copy(edges.begin(), edges.end(), ptBinArrayOut);
+  ptBinningName = scheme;
+
+  return true;
+}
+
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::ProcessSwitch(int iBin, double *pTHatBin, char **argv, Pythia8::Pythia &p){
 
@@ -200,6 +1697,8 @@ bool PythiaAnalysisHelper::IsPhotonIsolated(Event &event, int iPhoton, const dou
 
   double isoCone_dR = 999.;
   double isoCone_pt = 0.; // reset sum of energy in cone
+  nIsoQueries++;
+  nScannedParticles += event.size()-5;
   
   for (int iTrack = 5; iTrack < event.size(); iTrack++) {
     if ( !event[iTrack].isFinal() ) continue;
@@ -269,17 +1768,19 @@ void PythiaAnalysisHelper::Fill_Electron_Pt(Pythia8::Event &event, float etaMax,
 }
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_Pi0_Pt(Pythia8::Event &event, float etaMax, bool useRap, TH1 *h){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
   for (int i = 5; i < event.size(); i++) {
     if(useRap){
-      if(event[i].id() == 111 && TMath::Abs(event[i].y()) < etaMax ) h->Fill(event[i].pT());
+      if(event[i].id() == 111 && TMath::Abs(event[i].y()) < etaMax ) Fill_Pt(h, mom, event[i].pT());
     }else{
-      if(event[i].id() == 111 && TMath::Abs(event[i].eta()) < etaMax ) h->Fill(event[i].pT());      
+      if(event[i].id() == 111 && TMath::Abs(event[i].eta()) < etaMax ) Fill_Pt(h, mom, event[i].pT());      
     }
   }
   return;
 }
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_Pi0Primary_Pt(Pythia8::Event &event, float etaMax, bool useRap, TH1 *h){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
   for (int i = 5; i < event.size(); i++) {
     if(useRap){
       if(event[i].id() == 111 && TMath::Abs(event[i].y()) < etaMax ) {
@@ -293,7 +1794,7 @@ void PythiaAnalysisHelper::Fill_Pi0Primary_Pt(Pythia8::Event &event, float etaMa
 	       TMath::Abs(event[mI].id()) == 3322  || // Cascades
 	       TMath::Abs(event[mI].id()) == 3312)  ) // Cascades
 	  {
-	    h->Fill(event[i].pT());
+	    Fill_Pt(h, mom, event[i].pT());
 	  }
       }
     }else{
@@ -308,7 +1809,7 @@ void PythiaAnalysisHelper::Fill_Pi0Primary_Pt(Pythia8::Event &event, float etaMa
 	       TMath::Abs(event[mI].id()) == 3322  || // Cascades
 	       TMath::Abs(event[mI].id()) == 3312)  ) // Cascades
 	  {
-	    h->Fill(event[i].pT());
+	    Fill_Pt(h, mom, event[i].pT());
 	  }
       }
     }
@@ -317,62 +1818,68 @@ void PythiaAnalysisHelper::Fill_Pi0Primary_Pt(Pythia8::Event &event, float etaMa
 }
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_Eta_Pt(Pythia8::Event &event, float etaMax, bool useRap, TH1 *h){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
   for (int i = 5; i < event.size(); i++) {
     if(useRap){
-      if(event[i].id() == 221 && TMath::Abs(event[i].y()) < etaMax ) h->Fill(event[i].pT());
+      if(event[i].id() == 221 && TMath::Abs(event[i].y()) < etaMax ) Fill_Pt(h, mom, event[i].pT());
     }else{
-      if(event[i].id() == 221 && TMath::Abs(event[i].eta()) < etaMax ) h->Fill(event[i].pT());      
+      if(event[i].id() == 221 && TMath::Abs(event[i].eta()) < etaMax ) Fill_Pt(h, mom, event[i].pT());      
     }
   }
   return;
 }
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_EtaPrime_Pt(Pythia8::Event &event, float etaMax, bool useRap, TH1 *h){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
   for (int i = 5; i < event.size(); i++) {
     if(useRap){
-      if(event[i].id() == 331 && TMath::Abs(event[i].y()) < etaMax ) h->Fill(event[i].pT());
+      if(event[i].id() == 331 && TMath::Abs(event[i].y()) < etaMax ) Fill_Pt(h, mom, event[i].pT());
     }else{
-      if(event[i].id() == 331 && TMath::Abs(event[i].eta()) < etaMax ) h->Fill(event[i].pT());      
+      if(event[i].id() == 331 && TMath::Abs(event[i].eta()) < etaMax ) Fill_Pt(h, mom, event[i].pT());      
     }
   }
   return;
 }
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_Omega_Pt(Pythia8::Event &event, float etaMax, bool useRap, TH1 *h){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
   for (int i = 5; i < event.size(); i++) {
     if(useRap){
-      if(event[i].id() == 223 && TMath::Abs(event[i].y()) < etaMax ) h->Fill(event[i].pT());
+      if(event[i].id() == 223 && TMath::Abs(event[i].y()) < etaMax ) Fill_Pt(h, mom, event[i].pT());
     }else{
-      if(event[i].id() == 223 && TMath::Abs(event[i].eta()) < etaMax ) h->Fill(event[i].pT());      
+      if(event[i].id() == 223 && TMath::Abs(event[i].eta()) < etaMax ) Fill_Pt(h, mom, event[i].pT());      
     } 
   }
   return;
 }
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_Direct_Photon_Pt(Pythia8::Event &event, float etaMax, TH1 *h){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
   for (int i = 5; i < event.size(); i++) {
     if(event[i].isFinal() && event[i].id() == 22 && TMath::Abs(event[i].y()) < etaMax && event[i].status() < 90 )
-      h->Fill(event[i].pT()); 
+      Fill_Pt(h, mom, event[i].pT()); 
   }
   return;
 }
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_Shower_Photon_Pt(Pythia8::Event &event, float etaMax, TH1 *h){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
   for (int i = 5; i < event.size(); i++) {
     if(event[i].isFinal() && event[i].id() == 22 && TMath::Abs(event[i].eta()) < etaMax && event[i].status() < 90){
 	if( TMath::Abs(event[event[i].iTopCopy()].status() ) > 40 )
-	  h->Fill(event[i].pT());
+	  Fill_Pt(h, mom, event[i].pT());
       }
   }
   return;
 }
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_222_Photon_Pt(Pythia8::Event &event, float etaMax, TH1 *h){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
   for (int i = 5; i < event.size(); i++) {
     if(event[i].isFinal() && event[i].id() == 22 && TMath::Abs(event[i].eta()) < etaMax ) {
       if(event[i].status() < 90)
 	if( TMath::Abs(event[event[i].iTopCopy()].status() ) < 40 )
-	  h->Fill(event[i].pT());
+	  Fill_Pt(h, mom, event[i].pT());
     }
   }
   return;
@@ -407,6 +1914,7 @@ void PythiaAnalysisHelper::Fill_ElectronPos_Pt(Pythia8::Event &event, float etaM
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_Direct_Iso_Photon_Pt(Pythia8::Event &event, float etaMax, TH1 *h,
                                                   bool isoCharged, double iso_cone_radius, double iso_pt){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
   for (int i = 5; i < event.size(); i++) {
     if(event[i].isFinal() && event[i].id() == 22 && TMath::Abs(event[i].eta()) < etaMax ) {
       if(event[i].status() < 90){
@@ -433,7 +1941,7 @@ void PythiaAnalysisHelper::Fill_Direct_Iso_Photon_Pt(Pythia8::Event &event, floa
           }
 
         if( pt_temp <= iso_pt)
-          h->Fill(event[i].pT());
+          Fill_Pt(h, mom, event[i].pT());
 
         //----------------------------------------------
       }
@@ -443,15 +1951,158 @@ void PythiaAnalysisHelper::Fill_Direct_Iso_Photon_Pt(Pythia8::Event &event, floa
 }
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_Decay_Photon_Pt(Pythia8::Event &event, float etaMax, TH1 *h){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
   for (int i = 5; i < event.size(); i++) {
     if(event[i].isFinal() && event[i].id() == 22 && TMath::Abs(event[i].eta()) < etaMax ) {
-      if(event[i].status() > 90) h->Fill(event[i].pT());
+      if(event[i].status() > 90) Fill_Pt(h, mom, event[i].pT());
     }
   }
   return;
 }
 //----------------------------------------------------------------------
 //----------------------------------------------------------------------
+// |eta| (|y|) x pt accumulators: one fill per particle into the full acceptance etaMax,
+// the spectra for the individual acceptances are projected from them when writing
+void PythiaAnalysisHelper::Fill_Electron_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h){
+  Fill_EtaPt(event, etaMax, useRap, h, &PythiaAnalysisHelper::Is_Electron);
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_Pi0_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h){
+  Fill_EtaPt(event, etaMax, useRap, h, &PythiaAnalysisHelper::Is_Pi0);
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_Pi0Primary_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h){
+  Fill_EtaPt(event, etaMax, useRap, h, &PythiaAnalysisHelper::Is_Pi0Primary);
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_Eta_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h){
+  Fill_EtaPt(event, etaMax, useRap, h, &PythiaAnalysisHelper::Is_Eta);
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_EtaPrime_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h){
+  Fill_EtaPt(event, etaMax, useRap, h, &PythiaAnalysisHelper::Is_EtaPrime);
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_Omega_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h){
+  Fill_EtaPt(event, etaMax, useRap, h, &PythiaAnalysisHelper::Is_Omega);
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_Direct_Photon_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h){
+  Fill_EtaPt(event, etaMax, useRap, h, &PythiaAnalysisHelper::Is_Direct_Photon);
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_Shower_Photon_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h){
+  Fill_EtaPt(event, etaMax, useRap, h, &PythiaAnalysisHelper::Is_Shower_Photon);
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_222_Photon_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h){
+  Fill_EtaPt(event, etaMax, useRap, h, &PythiaAnalysisHelper::Is_222_Photon);
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_Decay_Photon_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h){
+  Fill_EtaPt(event, etaMax, useRap, h, &PythiaAnalysisHelper::Is_Decay_Photon);
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_Direct_Iso_Photon_EtaPt(Pythia8::Event &event, float etaMax, TH2 *h,
+                                                        bool isoCharged, double iso_cone_radius, double iso_pt){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
+  for (int i = 5; i < event.size(); i++) {
+    if( !Is_Direct_Photon(event, i) ) continue;
+    double etaAbs = TMath::Abs(event[i].eta());
+    if( etaAbs >= etaMax ) continue;
+    if( IsoCone_Pt(event, i, isoCharged, iso_cone_radius) <= iso_pt )
+      Fill_EtaPt(h, mom, etaAbs, event[i].pT());
+  }
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h, ParticleSelection isSelected){
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
+  nScannedParticles += event.size()-5;
+  for (int i = 5; i < event.size(); i++) {
+    if( !(this->*isSelected)(event, i) ) continue;
+    double etaAbs = useRap ? TMath::Abs(event[i].y()) : TMath::Abs(event[i].eta());
+    if( etaAbs < etaMax ) Fill_EtaPt(h, mom, etaAbs, event[i].pT());
+  }
+  return;
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_Electron(Pythia8::Event &event, int i){
+  return event[i].isFinal() && TMath::Abs(event[i].id()) == 11;
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_Pi0(Pythia8::Event &event, int i){
+  return event[i].id() == 111;
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_Pi0Primary(Pythia8::Event &event, int i){
+  if(event[i].id() != 111) return false;
+  int mI = event[i].mother1();
+  return !(TMath::Abs(event[mI].id()) == 310   || // K0_s, K0_l
+	   TMath::Abs(event[mI].id()) == 321   || // K+,K-
+	   TMath::Abs(event[mI].id()) == 3122  || // Lambda, Anti-Lambda
+	   TMath::Abs(event[mI].id()) == 3212  || // Sigma0
+	   TMath::Abs(event[mI].id()) == 3222  || // Sigmas
+	   TMath::Abs(event[mI].id()) == 3112  || // Sigmas
+	   TMath::Abs(event[mI].id()) == 3322  || // Cascades
+	   TMath::Abs(event[mI].id()) == 3312);   // Cascades
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_Eta(Pythia8::Event &event, int i){
+  return event[i].id() == 221;
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_EtaPrime(Pythia8::Event &event, int i){
+  return event[i].id() == 331;
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_Omega(Pythia8::Event &event, int i){
+  return event[i].id() == 223;
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_Direct_Photon(Pythia8::Event &event, int i){
+  return event[i].isFinal() && event[i].id() == 22 && event[i].status() < 90;
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_Shower_Photon(Pythia8::Event &event, int i){
+  return Is_Direct_Photon(event, i) && TMath::Abs(event[event[i].iTopCopy()].status()) > 40;
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_222_Photon(Pythia8::Event &event, int i){
+  return Is_Direct_Photon(event, i) && TMath::Abs(event[event[i].iTopCopy()].status()) < 40;
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Is_Decay_Photon(Pythia8::Event &event, int i){
+  return event[i].isFinal() && event[i].id() == 22 && event[i].status() > 90;
+}
+//----------------------------------------------------------------------
+double PythiaAnalysisHelper::IsoCone_Pt(Pythia8::Event &event, int i, bool isoCharged, double iso_cone_radius){
+  double pt_temp = 0.;
+  nIsoQueries++;
+  nScannedParticles += event.size()-5;
+  for(int j = 5; j < event.size(); j++){
+    // only charged considered for iso cut if isoCharged, else charged + neutral
+    if( !event[j].isFinal() || !event[j].isVisible() || j == i) continue;
+    if( isoCharged && !event[j].isCharged() ) continue;
+    if( TMath::Sqrt(   (event[i].phi()-event[j].phi()) * (event[i].phi()-event[j].phi())
+                       + (event[i].eta()-event[j].eta()) * (event[i].eta()-event[j].eta()) )
+        < iso_cone_radius)
+      pt_temp += event[j].pT();
+  }
+  return pt_temp;
+}
+//----------------------------------------------------------------------
+//----------------------------------------------------------------------
 //----------------------------------------------------------------------
 void PythiaAnalysisHelper::Fill_invXsec_Pi0_Pt(Pythia8::Event &event, float etaMax, bool useRap, TH1 *h){
   for (int i = 5; i < event.size(); i++) {
@@ -613,6 +2264,8 @@ void PythiaAnalysisHelper::Fill_iso_Direct_Photon_Pt(Pythia8::Event &event, floa
       {
         // isolation check------------------------------
         double pt_temp = 0.;
+        nIsoQueries++;
+        nScannedParticles += event.size()-5;
         if (isoCharged)
           for (int j = 5; j < event.size(); j++)
           {
@@ -632,6 +2285,7 @@ void PythiaAnalysisHelper::Fill_iso_Direct_Photon_Pt(Pythia8::Event &event, floa
           }
 
           h->Fill(pt_temp);
+          nHistoFills++;
         //----------------------------------------------
       }
     }
@@ -651,6 +2305,8 @@ void PythiaAnalysisHelper::Fill_iso_Decay_Photon_Pt(Pythia8::Event &event, float
         if (TMath::Abs(event[event[i].iTopCopy()].status()) < 40){
           // isolation check------------------------------
           double pt_temp = 0.;
+          nIsoQueries++;
+          nScannedParticles += event.size()-5;
           if (isoCharged)
             for (int j = 5; j < event.size(); j++)
             {
@@ -670,6 +2326,7 @@ void PythiaAnalysisHelper::Fill_iso_Decay_Photon_Pt(Pythia8::Event &event, float
             }
 
           h->Fill(pt_temp);
+          nHistoFills++;
         //----------------------------------------------
         }
       }
@@ -687,6 +2344,8 @@ void PythiaAnalysisHelper::Fill_iso_All_Photon_Pt(Pythia8::Event &event, float e
     {
       // isolation check------------------------------
       double pt_temp = 0.;
+      nIsoQueries++;
+      nScannedParticles += event.size()-5;
       if (isoCharged)
         for (int j = 5; j < event.size(); j++)
         {
@@ -706,6 +2365,7 @@ void PythiaAnalysisHelper::Fill_iso_All_Photon_Pt(Pythia8::Event &event, float e
         }
 
       h->Fill(pt_temp);
+      nHistoFills++;
       //----------------------------------------------
     }
   }
@@ -797,6 +2457,259 @@ void PythiaAnalysisHelper::Fill_Electron_Pt_ByTopMotherID(Pythia8::Event &event,
 //----------------------------------------------------------------------
 //----------------------------------------------------------------------
 //----------------------------------------------------------------------
+// 1/pT moments: the invariant cross section in a pt bin is sum(w/pT)/(2pi),
+// its error sqrt(sum(w^2/pT^2))/(2pi) -> both are summed in the same pass
+// as the "normal" spectrum, so no second set of fills/histos is needed
+void PythiaAnalysisHelper::Book_InvXsec_Moments(std::vector <TH1D*> &vec){
+
+  for(unsigned int i = 0; i < vec.size(); i++)
+    Book_InvXsec_Moments(vec.at(i), i);
+
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Book_InvXsec_Moments(std::vector <TH2D*> &vec){
+
+  for(unsigned int i = 0; i < vec.size(); i++)
+    Book_InvXsec_Moments(vec.at(i), i);
+
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Book_InvXsec_Moments(TH1 *h, int iBin){
+
+  InvXsecMoments &mom = map_invXsecMoments[h];
+  mom.histo = h;
+  mom.pTHatBin = iBin;
+  mom.sumInvPt.assign(h->GetNcells(), 0.);
+  mom.sumInvPt2.assign(h->GetNcells(), 0.);
+
+  if(Find_InvXsec_Moments(h) != &mom){
+    vec_invXsecMomentsCache.push_back(&mom);
+    h->SetUniqueID(vec_invXsecMomentsCache.size());
+  }
+
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Scale_InvXsec_Moments(int iBin, double scale){
+
+  std::map<const TH1*, InvXsecMoments>::iterator it;
+  for(it = map_invXsecMoments.begin(); it != map_invXsecMoments.end(); ++it){
+    if(it->second.pTHatBin != iBin) continue;
+    for(unsigned int j = 0; j < it->second.sumInvPt.size(); j++){
+      it->second.sumInvPt.at(j)  *= scale;
+      it->second.sumInvPt2.at(j) *= scale*scale;
+    }
+  }
+
+  return;
+}
+//----------------------------------------------------------------------
+bool PythiaAnalysisHelper::Has_InvXsec_Moments(std::vector <TH1D*> &vec){
+
+  if(vec.size() < 1) return false;
+  for(unsigned int i = 0; i < vec.size(); i++)
+    if(!Find_InvXsec_Moments(vec.at(i))) return false;
+
+  return true;
+}
+//----------------------------------------------------------------------
+std::vector <TH1D*> PythiaAnalysisHelper::Derive_InvXsec_Histos(std::vector <TH1D*> &vec, TH1* final_histo){
+
+  std::vector <TH1D*> vec_invXsec;
+  if(!Has_InvXsec_Moments(vec)){
+    printf("Derive_InvXsec_Histos: no 1/pT moments booked for %s. Aborting...\n", final_histo->GetName());
+    return vec_invXsec;
+  }
+
+  for(unsigned int i = 0; i < vec.size(); i++)
+    vec_invXsec.push_back( (TH1D*)Derive_InvXsec_Histo(vec.at(i), final_histo, i) );
+
+  return vec_invXsec;
+}
+//----------------------------------------------------------------------
+TH1 *PythiaAnalysisHelper::Derive_InvXsec_Histo(TH1 *h, TH1 *final_histo, int iBin){
+
+  InvXsecMoments *mom = Find_InvXsec_Moments(h);
+  TH1 *h_invXsec = (TH1*)final_histo->Clone(Form("%s_bin_%02d", final_histo->GetName(), iBin));
+  h_invXsec->Reset();
+  if(h_invXsec->GetSumw2N() == 0) h_invXsec->Sumw2();
+  for(int j = 0; j < h_invXsec->GetNcells(); j++){
+    h_invXsec->SetBinContent(j, mom->sumInvPt.at(j)/(2*TMath::Pi()));
+    h_invXsec->SetBinError(j, TMath::Sqrt(mom->sumInvPt2.at(j))/(2*TMath::Pi()));
+  }
+  h_invXsec->SetEntries(h->GetEntries());
+
+  return h_invXsec;
+}
+//----------------------------------------------------------------------
+PythiaAnalysisHelper::InvXsecMoments *PythiaAnalysisHelper::Find_InvXsec_Moments(const TH1 *h){
+
+  unsigned int id = h->GetUniqueID();
+  if(id == 0 || id > vec_invXsecMomentsCache.size()) return NULL;
+  InvXsecMoments *mom = vec_invXsecMomentsCache.at(id-1);
+  if(!mom || mom->histo != h) return NULL;
+
+  return mom;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_Pt(TH1 *h, InvXsecMoments *mom, double pt){
+
+  int bin = h->Fill(pt);
+  nHistoFills++;
+  if(mom && bin >= 0){
+    mom->sumInvPt.at(bin)  += 1./pt;
+    mom->sumInvPt2.at(bin) += 1./(pt*pt);
+  }
+
+  return;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Fill_EtaPt(TH2 *h, InvXsecMoments *mom, double etaAbs, double pt){
+
+  int bin = h->Fill(etaAbs, pt);
+  nHistoFills++;
+  if(mom && bin >= 0){
+    mom->sumInvPt.at(bin)  += 1./pt;
+    mom->sumInvPt2.at(bin) += 1./(pt*pt);
+  }
+
+  return;
+}
+//----------------------------------------------------------------------
+// projection of the |eta| x pt accumulators onto the acceptance [etaMin,etaMax)
+// -> clones of final_histo (pt binning has to match the y axis of the accumulators)
+std::vector <TH1D*> PythiaAnalysisHelper::Project_EtaPt(std::vector <TH2D*> &vec, double etaMin, double etaMax, TH1* final_histo){
+
+  std::vector <TH1D*> vec_proj;
+  if(vec.size() < 1) return vec_proj;
+
+  TAxis *etaAxis = vec.at(0)->GetXaxis();
+  int etaBinMin = etaAxis->FindBin(etaMin);
+  int etaBinMax = etaAxis->FindBin(etaMax) - 1;
+  if( etaBinMin > etaBinMax ||
+      TMath::Abs(etaAxis->GetBinLowEdge(etaBinMin) - etaMin) > 1e-9 ||
+      TMath::Abs(etaAxis->GetBinUpEdge(etaBinMax) - etaMax) > 1e-9 ){
+    printf("Project_EtaPt: acceptance %.3f-%.3f of %s not aligned with eta bin edges. Aborting...\n", etaMin, etaMax, final_histo->GetName());
+    return vec_proj;
+  }
+  // pt: every edge of final_histo has to be an edge of the accumulator -> exact rebinning
+  TAxis *ptAxis = vec.at(0)->GetYaxis();
+  for(int j = 1; j <= final_histo->GetNbinsX()+1; j++){
+    double edge = final_histo->GetXaxis()->GetBinLowEdge(j);
+    int jFine = ptAxis->FindBin(edge);
+    if( jFine > ptAxis->GetNbins() ) jFine = ptAxis->GetNbins()+1; // last edge of final_histo = last edge of accumulator
+    if( TMath::Abs(ptAxis->GetBinLowEdge(jFine) - edge) > 1e-9 ){
+      printf("Project_EtaPt: pt edge %.3f of %s is not an edge of %s. Aborting...\n", edge, final_histo->GetName(), vec.at(0)->GetName());
+      return vec_proj;
+    }
+  }
+
+  for(unsigned int i = 0; i < vec.size(); i++){
+    TH2D *h2 = vec.at(i);
+    InvXsecMoments *mom2 = Find_InvXsec_Moments(h2);
+
+    TH1D *h = (TH1D*)final_histo->Clone(Form("%s_bin_%02d", final_histo->GetName(), i));
+    h->SetDirectory(0);
+    h->Reset();
+    if(h->GetSumw2N() == 0) h->Sumw2();
+    InvXsecMoments *mom = NULL;
+    if(mom2){
+      Book_InvXsec_Moments(h, i);
+      mom = Find_InvXsec_Moments(h);
+    }
+
+    std::vector <double> content(h->GetNbinsX()+2, 0.), error2(h->GetNbinsX()+2, 0.);
+    for(int jFine = 0; jFine < ptAxis->GetNbins()+2; jFine++){
+      int j = 0;
+      if( jFine > ptAxis->GetNbins() ) j = h->GetNbinsX()+1;
+      else if( jFine > 0 ) j = h->GetXaxis()->FindBin(ptAxis->GetBinCenter(jFine)); // under-/overflow if outside final_histo
+      for(int k = etaBinMin; k <= etaBinMax; k++){
+	int bin2 = h2->GetBin(k, jFine);
+	content.at(j) += h2->GetBinContent(bin2);
+	error2.at(j)  += h2->GetBinError(bin2)*h2->GetBinError(bin2);
+	if(mom){
+	  mom->sumInvPt.at(j)  += mom2->sumInvPt.at(bin2);
+	  mom->sumInvPt2.at(j) += mom2->sumInvPt2.at(bin2);
+	}
+      }
+    }
+    for(int j = 0; j < h->GetNbinsX()+2; j++){
+      h->SetBinContent(j, content.at(j));
+      h->SetBinError(j, TMath::Sqrt(error2.at(j)));
+    }
+    h->SetEntries(h->GetEffectiveEntries());
+    vec_proj.push_back(h);
+  }
+
+  return vec_proj;
+}
+//----------------------------------------------------------------------
+void PythiaAnalysisHelper::Project_Scale_Write2File( std::vector <TH2D*>& vec, double etaMin, double etaMax, TH1* final_histo, TFile &file, TDirectory *dir, bool useRap, bool isInvariantXsec){
+
+  std::vector <TH1D*> vec_proj = Project_EtaPt(vec, etaMin, etaMax, final_histo);
+  if(vec_proj.size() < 1) return;
+
+  Add_Histos_Scale_Write2File(vec_proj, final_histo, file, dir, 2.*(etaMax-etaMin), useRap, isInvariantXsec);
+
+  for(unsigned int i = 0; i < vec_proj.size(); i++){
+    InvXsecMoments *mom = Find_InvXsec_Moments(vec_proj.at(i));
+    if(mom) vec_invXsecMomentsCache.at(vec_proj.at(i)->GetUniqueID()-1) = NULL;
+    map_invXsecMoments.erase(vec_proj.at(i));
+    delete vec_proj.at(i);
+  }
+
+  return;
+}
+//----------------------------------------------------------------------
+// |eta| x pt accumulators are written as cross section per cell (no width scaling),
+// so that any acceptance can be projected offline (see macros/project_acceptance.C)
+void PythiaAnalysisHelper::Add_Histos_Write2File( std::vector <TH2D*>& vec, TH2* final_histo, TFile &file, TDirectory *dir, bool isInvariantXsec){
+
+  file.cd();
+  dir->cd();
+
+  std::vector <TH2D*> vec_invXsec;
+  if(isInvariantXsec && vec.size()){
+    for(unsigned int i = 0; i < vec.size(); i++){
+      if(!Find_InvXsec_Moments(vec.at(i))){
+	printf("Add_Histos_Write2File: no 1/pT moments booked for %s. Aborting...\n", vec.at(i)->GetName());
+	for(unsigned int j = 0; j < vec_invXsec.size(); j++) delete vec_invXsec.at(j);
+	gROOT->cd();
+	return;
+      }
+      vec_invXsec.push_back( (TH2D*)Derive_InvXsec_Histo(vec.at(i), final_histo, i) );
+    }
+  }
+  std::vector <TH2D*> &vec_out = vec_invXsec.size() ? vec_invXsec : vec;
+
+  TString name = final_histo->GetName();
+  const char *xTitle = name.Contains("yPt") ? "|y|" : "|#eta|";
+  const char *zTitle = isInvariantXsec ? "#frac{1}{2#pi p_{T}} #sigma (pb)" : "#sigma (pb)";
+
+  for(unsigned int i = 0; i < vec_out.size(); i++){
+    final_histo->Add(vec_out.at(i));
+    vec_out.at(i)->SetXTitle(xTitle);
+    vec_out.at(i)->SetYTitle("p_{T} (GeV/#it{c})");
+    vec_out.at(i)->SetZTitle(zTitle);
+    Write_Async(dir, vec_out.at(i));
+  }
+
+  final_histo->SetXTitle(xTitle);
+  final_histo->SetYTitle("p_{T} (GeV/#it{c})");
+  final_histo->SetZTitle(zTitle);
+  Write_Async(dir, final_histo);
+
+  for(unsigned int i = 0; i < vec_invXsec.size(); i++) delete vec_invXsec.at(i);
+
+  gROOT->cd();
+
+  return;
+}
+//----------------------------------------------------------------------
+//----------------------------------------------------------------------
+//----------------------------------------------------------------------
 // void PythiaAnalysisHelper::Add_Histos_Scale_Write2File( std::vector <TH1D*>& vec, TH1* final_histo, TFile &file, double etaRange, bool useRap, bool isInvariantXsec){
 
 //   file.cd();
@@ -836,54 +2749,59 @@ void PythiaAnalysisHelper::Add_Histos_Scale_Write2File( std::vector <TH1D*>& vec
   file.cd();
   dir->cd();
 
-  for(unsigned int i = 0; i < vec.size(); i++){
-    final_histo->Add(vec.at(i));
-    vec.at(i)->Scale(1./etaRange, "width");
-    vec.at(i)->SetXTitle("p_{T} (GeV/#it{c})");
+  // invariant cross sections are derived from the 1/pT moments of the "normal" spectra, if booked
+  std::vector <TH1D*> vec_invXsec;
+  if(isInvariantXsec && Has_InvXsec_Moments(vec)) vec_invXsec = Derive_InvXsec_Histos(vec, final_histo);
+  std::vector <TH1D*> &vec_out = vec_invXsec.size() ? vec_invXsec : vec;
+
+  for(unsigned int i = 0; i < vec_out.size(); i++){
+    final_histo->Add(vec_out.at(i));
+    vec_out.at(i)->Scale(1./etaRange, "width");
+    vec_out.at(i)->SetXTitle("p_{T} (GeV/#it{c})");
     if(isInvariantXsec){
-      if(useRap) vec.at(i)->SetYTitle("#frac{1}{2#pi p_{T}} #frac{d^{2}#sigma}{dp_{T}dy} (pb)");
-      else vec.at(i)->SetYTitle("#frac{1}{2#pi p_{T}} #frac{d^{2}#sigma}{dp_{T}d#eta} (pb)");
+      if(useRap) vec_out.at(i)->SetYTitle("#frac{1}{2#pi p_{T}} #frac{d^{2}#sigma}{dp_{T}dy} (pb)");
+      else vec_out.at(i)->SetYTitle("#frac{1}{2#pi p_{T}} #frac{d^{2}#sigma}{dp_{T}d#eta} (pb)");
     }else{
-      if(useRap) vec.at(i)->SetYTitle("#frac{d^{2}#sigma}{dp_{T}dy} (pb)");
-      else vec.at(i)->SetYTitle("#frac{d^{2}#sigma}{dp_{T}d#eta} (pb)");
+      if(useRap) vec_out.at(i)->SetYTitle("#frac{d^{2}#sigma}{dp_{T}dy} (pb)");
+      else vec_out.at(i)->SetYTitle("#frac{d^{2}#sigma}{dp_{T}d#eta} (pb)");
     }
 
     // special treatment for gamma jet correlations histos
-    TString axTitleTemp = vec.at(i)->GetName();
+    TString axTitleTemp = vec_out.at(i)->GetName();
     if( axTitleTemp.Contains("xJetGamma") ){
-      vec.at(i)->SetXTitle("x_{J#gamma}");
-      vec.at(i)->SetYTitle("d#sigma_{J#gamma}/dx_{J#gamma} (pb)");
+      vec_out.at(i)->SetXTitle("x_{J#gamma}");
+      vec_out.at(i)->SetYTitle("d#sigma_{J#gamma}/dx_{J#gamma} (pb)");
     }
     if( axTitleTemp.Contains("dPhiJetGamma") ){
-      vec.at(i)->SetXTitle("#Delta #phi_{J#gamma}");
-      vec.at(i)->SetYTitle("d#sigma_{J#gamma}/d#Delta #phi_{J#gamma} (pb)");
+      vec_out.at(i)->SetXTitle("#Delta #phi_{J#gamma}");
+      vec_out.at(i)->SetYTitle("d#sigma_{J#gamma}/d#Delta #phi_{J#gamma} (pb)");
     }
     if( axTitleTemp.Contains("chJetTrackMult") ){
-      vec.at(i)->SetXTitle("number of charged tracks per jet N_{chTr,jet}");
-      vec.at(i)->SetYTitle("#sigma_{chTr,jet}/dN_{chTr,jet} (pb)");
+      vec_out.at(i)->SetXTitle("number of charged tracks per jet N_{chTr,jet}");
+      vec_out.at(i)->SetYTitle("#sigma_{chTr,jet}/dN_{chTr,jet} (pb)");
     }
     if( axTitleTemp.Contains("xObs") ){
-      vec.at(i)->SetXTitle("x^{obs}_{Pb}");
-      vec.at(i)->SetYTitle("d#sigma_{J#gamma}/dx^{obs}_{Pb} (pb)");
+      vec_out.at(i)->SetXTitle("x^{obs}_{Pb}");
+      vec_out.at(i)->SetYTitle("d#sigma_{J#gamma}/dx^{obs}_{Pb} (pb)");
     }
     if( axTitleTemp.Contains("isoCone_track_dPhi") ){
-      vec.at(i)->SetXTitle("#Delta #phi_{#gamma--track}");
-      vec.at(i)->SetYTitle("d#sigma_{tracks}/d#Delta #phi_{#gamma--track} (pb)");
+      vec_out.at(i)->SetXTitle("#Delta #phi_{#gamma--track}");
+      vec_out.at(i)->SetYTitle("d#sigma_{tracks}/d#Delta #phi_{#gamma--track} (pb)");
     }
     if( axTitleTemp.Contains("isoCone_track_dEta") ){
-      vec.at(i)->SetXTitle("#Delta #eta_{#gamma--track}");
-      vec.at(i)->SetYTitle("d#sigma_{tracks}/d#Delta #eta_{#gamma--track} (pb)");
+      vec_out.at(i)->SetXTitle("#Delta #eta_{#gamma--track}");
+      vec_out.at(i)->SetYTitle("d#sigma_{tracks}/d#Delta #eta_{#gamma--track} (pb)");
     }
     if( axTitleTemp.Contains("Bjorken") ){
-      vec.at(i)->SetXTitle("real Bjorken x for given gamma-jet pair");
-      vec.at(i)->SetYTitle("d#sigma_{J#gamma}/dx (pb)");
+      vec_out.at(i)->SetXTitle("real Bjorken x for given gamma-jet pair");
+      vec_out.at(i)->SetYTitle("d#sigma_{J#gamma}/dx (pb)");
     }
     if( axTitleTemp.Contains("xSecTriggerGamma") ){
-      vec.at(i)->SetXTitle("");
-      vec.at(i)->SetYTitle("#sigma_{J#gamma} (pb)");
+      vec_out.at(i)->SetXTitle("");
+      vec_out.at(i)->SetYTitle("#sigma_{J#gamma} (pb)");
     }
 
-    vec.at(i)->Write();
+    Write_Async(dir, vec_out.at(i));
 
   }
 
@@ -933,7 +2851,9 @@ void PythiaAnalysisHelper::Add_Histos_Scale_Write2File( std::vector <TH1D*>& vec
     }
 
   
-  final_histo->Write();
+  Write_Async(dir, final_histo);
+
+  for(unsigned int i = 0; i < vec_invXsec.size(); i++) delete vec_invXsec.at(i);
 
   gROOT->cd();
 
@@ -986,7 +2906,7 @@ void PythiaAnalysisHelper::Add_Histos_Scale_Write2File_Powheg( std::vector <TH1D
       vec.at(i).SetYTitle("#sigma_{J#gamma} (pb)");
     }
 
-    vec.at(i).Write();
+    Write_Async(&file, &vec.at(i));
 
   }
 
@@ -1013,7 +2933,7 @@ void PythiaAnalysisHelper::Add_Histos_Scale_Write2File( std::vector <TH2D*>& vec
       if(useRap) vec.at(i)->SetZTitle("#frac{d^{2}#sigma}{dp_{T}dy} (pb)");
       else vec.at(i)->SetZTitle("#frac{d^{2}#sigma}{dp_{T}d#eta} (pb)");
     }
-    vec.at(i)->Write();
+    Write_Async(dir, vec.at(i));
   }
 
   final_histo->Scale(1./etaRange, "width");
@@ -1026,7 +2946,7 @@ void PythiaAnalysisHelper::Add_Histos_Scale_Write2File( std::vector <TH2D*>& vec
     if(useRap) final_histo->SetZTitle("#frac{d^{2}#sigma}{dp_{T}dy} (pb)");
     else final_histo->SetZTitle("#frac{d^{2}#sigma}{dp_{T}d#eta} (pb)");
   }
-  final_histo->Write();
+  Write_Async(dir, final_histo);
 
   gROOT->cd();
 
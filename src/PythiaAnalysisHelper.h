@@ -5,7 +5,18 @@
 #include "TH1.h"
 #include "TH2.h"
 #include "TFile.h"
+#include "TTree.h"
+#include "TChain.h"
 #include <vector>
+#include <map>
+#include <ctime>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <atomic>
 #include "TMath.h"
 #include "TCanvas.h"
 #include "TPaveText.h"
@@ -23,14 +34,151 @@ class PythiaAnalysisHelper{
 
  public:
 
-  PythiaAnalysisHelper(){};
-  //  ~PythiaAnalysisHelper(){} // destructor not needed, if no member variables
+  PythiaAnalysisHelper(){ Set_PtBinning("default"); };
+  ~PythiaAnalysisHelper(){ Stop_Writer(); Close_Progress(); }
 
   void Set_Pythia_Randomseed(Pythia8::Pythia &p); // set seed with ROOT's TRandom3
+
+  // reproducible seeding of a campaign: SEED = campaign seed, the seed of every random stream follows from
+  // (campaign seed, task ID, thread index, pTHat bin), the streams of one campaign are distinct by construction
+  bool Set_Campaign_Seed(const char *taskID); // false if SEED or the task ID (argv[1] or SLURM_ARRAY_TASK_ID) is invalid
+  void Set_Stream_Seed(Pythia8::Pythia &p, int iBin, int iThread = 0); // before p.init() of the bin, no-op without SEED
+  long Get_Stream_Seed(int iBin, int iThread);
+
+  // MPI mode (built with -DUSE_MPI, e.g. make PythiaAnalysis_mpi): the ranks generate independently (campaign seed,
+  // task = rank), all histograms are summed in memory into rank 0, which writes the only output (no-ops without USE_MPI);
+  // the output is the sum as by hadd of the rank outputs, i.e. it is normalized by normalize like a single job output
+  void Init_MPI(int *argc, char ***argv); // without SEED the start time of rank 0 is the campaign seed of all ranks
+  int Get_MPI_Rank(){ return mpiRank; }
+  int Get_MPI_Size(){ return mpiSize; }
+  bool Sync_Bin_MPI(int iBin, double nEvents, bool stop); // before each pTHat bin: progress of all ranks on rank 0, true if any rank stops
+  // all TH1D/TH2D in gROOT incl. 1/pT moments, plus extraHistos (histograms in no directory, e.g. the vector<TH1D> of ShowerAnalysis);
+  // false if the ranks booked different histograms
+  bool Reduce_Histograms_MPI(std::vector<TH1*> extraHistos = std::vector<TH1*>());
+  // checkpoints between pTHat bins: rank 0 writes the sum of all ranks (campaign state) to fileName, the histograms stay per rank;
+  // on resume rank 0 continues with the sums, the other ranks from scratch, all from the broadcast pTHat bin
+  bool Write_Checkpoint_MPI(const char *fileName, const char *runID, int iBin);
+  bool Read_Checkpoint_MPI(const char *fileName, const char *runID, int &iBin); // false if no matching checkpoint
+  void Finalize_MPI();
+
+  // fork-server mode: the server initialises each pTHat bin once (XML database, PDF grids, MPI tables) and forks
+  // nWorkers workers sharing that memory copy-on-write; every worker generates the events of one task with its own
+  // seed (thread index = worker) and returns its histograms through a pipe, the server sums them
+  // no other thread (Start_Writer, Open_Progress) may run at the call, a worker could inherit a locked mutex
+  int Fork_Workers(Pythia8::Pythia &p, int iBin, int nWorkers); // worker index in a worker, -1 in the server once all workers returned
+  void Return_To_Server(); // worker: histograms of the bin to the server, ends the worker process
+
   void Pass_Parameters_To_Pythia(Pythia8::Pythia &p, int argc, char **argv); // set stuff with one line; check .cxx for enlightenment
   void Write_README(Pythia8::Pythia &p, TFile &file, int argc, char **argv, string pdfA, string pdfB, double *pTHatBin);
   void ProcessSwitch(int iBin, double *pTHatBin, char **argv, Pythia8::Pythia &p); // set pTHat bin specific stuff
 
+  // generator bookkeeping per pTHat bin; all entries are sums, so outputs can be merged by plain addition (haddav)
+  // name has to contain "weightSum" to be skipped as spectrum by the normalization
+  TH1D* Book_Generator_Info(const char *name);
+  void Fill_Generator_Info(TH1D *h_info, const Pythia8::Info &info, double sumW2); // sumW2 = sum of squared event weights
+  double Get_SigmaGen(TH1 *h_info); // merged sigmaGen (pb) = sum(sigmaGen*nTried)/sum(nTried)
+  double Get_SigmaErr(TH1 *h_info); // merged error of sigmaGen (pb)
+
+  // checkpoints of a generation run: all histograms in memory, the 1/pT moments, the position (pTHat bin,
+  // events done in it) and the Pythia random state; the generator info of the running bin (h_info) is
+  // stored incl. the events generated so far, so a resumed bin continues as an additive segment
+  bool Write_Checkpoint(Pythia8::Pythia &p, const char *fileName, const char *runID, int iBin, int iEvent, TH1D *h_info, double sumW2); // atomic (tmp file + rename), written by the writer thread if started
+  bool Read_Checkpoint(const char *fileName, const char *runID, int &iBin, int &iEvent); // false if no matching checkpoint
+  bool Restore_Random_State(Pythia8::Pythia &p); // after p.init() of the resumed bin
+
+  // graceful end of the generation within the batch time limit: DEADLINE = seconds after the start (0: signals only),
+  // SIGTERM, SIGUSR1 and SIGUSR2 end the generation as well; the remaining time is shared by the remaining pTHat bins
+  bool Set_Deadline(); // false if DEADLINE is not set
+  void Start_Deadline_Bin(int nBinsLeft); // time budget of the next bin
+  bool Is_Deadline_Reached(); // per event: true if the current bin has to be closed
+  bool Is_Stop_Requested(); // true if no further bin shall be started
+
+  // background writer thread: objects are written from detached copies in order of submission, so the generation
+  // (or the preparation of the next histograms) goes on while the previous ones are serialised, compressed and written;
+  // without Start_Writer all writes are synchronous
+  void Start_Writer();
+  void Stop_Writer(); // final flush: waits until everything is written, then ends the thread
+  void Flush_Writer(); // waits until everything submitted so far is written
+  void Write_Async(TDirectory *dir, const TObject *obj); // a copy of obj is written to dir, obj can be changed or deleted right away (waits while 256 MB of copies are queued)
+  TDirectory* Mkdir_Output(TDirectory *mother, const char *name); // use instead of mother->mkdir while the writer may write to the same file
+
+  // event information used by the analysis, from Pythia or from the event store
+  struct EventInfo{
+    double pTHat, x1, x2, eB;
+    std::vector<double> weights; // nominal weight first
+  };
+  void Get_Event_Info(Pythia8::Pythia &p, EventInfo &info);
+
+  // particle-level event store for re-analysis without regeneration: per accepted event the particles with |eta| < etaMax
+  // (etaMax < 0: all) that are final or mesons of the spectra (pi0, eta, eta', omega), plus the mothers and top copies the
+  // analysis looks at (three levels up), in the TTree "events" with one branch per field (LZ4, clusters of 1000 events);
+  // the mother links are re-indexed, so that mother1(), iTopCopy() and iTopCopyId() lead to the same ids as in the full event
+  bool Open_Event_Store(const char *fileName, double etaMax);
+  void Store_Event(Pythia8::Event &event, EventInfo &info, int iBin);
+  void Close_Event_Store(std::vector <TH1D*> &vec_genInfo); // the generator info per pTHat bin is stored for the normalisation of replays
+
+  // replay of event stores: the events of each pTHat bin are split into nChunks chunks of which chunk iChunk is analysed;
+  // its generator info is the stored one times the fraction of events in the chunk, so the chunk outputs add up (haddav, normalize)
+  bool Open_Replay(const char *fileNames, int iChunk, int nChunks); // file names may contain wildcards
+  int Get_Replay_Events(int iBin); // events of the chunk in pTHat bin iBin
+  bool Next_Replay_Event(Pythia8::Event &event, EventInfo &info, int iBin); // event record rebuilt from the store
+  void Get_Replay_Generator_Info(int iBin, TH1D *h_info);
+  void Close_Replay();
+
+  // per-event weight log, a side table for large-weight studies (weight cuts, Born veto factors) without the histograms:
+  // event number, pTHat bin, pTHat, POWHEG Born scale "uborns" (0 for Pythia), leading photon pT (-1: none), all weights,
+  // the seed to regenerate the event (0 without per-event seeds) and whether the event was vetoed (MBVeto, Born veto), in the TTree "weightLog" of fileName;
+  // vetoed events are logged as well, select "!vetoed" for the events in the histograms
+  bool Open_Weight_Log(const char *fileName);
+  void Log_Event_Weights(Long64_t iEvent, int iBin, double pTHat, double uborns, double photonPt, const std::vector<double> &weights, Long64_t seed, bool vetoed);
+  void Close_Weight_Log();
+  double Get_Leading_Direct_Photon_Pt(Pythia8::Event &event, float etaMax); // -1 if none
+
+  // per-event seeds: every event is generated with its own seed derived from (job seed, pTHat bin, event index),
+  // so single events (e.g. outliers in the weight log) can be regenerated without the rest of the job
+  long Get_Event_Seed(long jobSeed, int iBin, long iEvent); // in [1, 900000000] as required by Pythia
+  void Reseed_Event(Pythia8::Pythia &p, long eventSeed); // right before p.next()
+  bool Read_Event_List(const char *fileName, std::map<int, std::map<long,long> > &events); // lines "iBin iEvent seed", '#' comments; events[iBin][iEvent] = seed, false on seeds <= 0
+
+  // per-stage timing (TIMING = 1): wall time of the stages of every pTHat bin (steady clock) and counters of the events,
+  // the particles scanned by the fill and isolation loops, the histogram fills and the isolation queries; stored in the
+  // TTree "timing" of the output (one entry per pTHat bin, iBin = -1 for the writing) and printed as table at the end.
+  // Fork-server mode: the server's share only (init, scale, write), MPI: the timing of rank 0.
+  // ShowerAnalysis: iBin = 0 with init, generation, fills (leading photon, Born veto) and gammaJet, iBin = -1 for the writing.
+  // PERFCOUNTERS = 1 (Linux, implies TIMING): in addition cycles, instructions, cache misses and branch misses of the main
+  // thread per stage and bin from perf_event_open (no tools needed, kernel.perf_event_paranoid <= 2); memory-bound stages
+  // show up with a low IPC and many cache misses per instruction.
+  // Start_Stage, Stop_Stage and Stage_Timer are guarded at the call site by a local bool hoisted out of the event loop,
+  // so disabled they cost a register test
+  enum TimingStage { kInit, kGeneration, kGammaJet, kFills, kIsolation, kScale, kWrite, nTimingStages };
+  void Enable_Timing(){ useTiming = true; }
+  bool Enable_Perf_Counters(); // false if perf_event_open is not available, the timing runs without counters then
+  void Start_Timing_Bin(int iBin); // closes the previous bin
+  void Start_Stage(int stage); // only with Enable_Timing
+  void Stop_Stage(int stage);
+  void Count_Event(){ nTimedEvents++; }
+  void Write_Timing(TFile &file); // closes the last bin; after Stop_Writer, the tree is written directly
+  class Stage_Timer{ // scoped: the stage runs until the end of the enclosing block (also left by break/continue)
+  public:
+    Stage_Timer(PythiaAnalysisHelper &help, int stage, bool active) : helper(help), iStage(stage), isActive(active){ if(isActive) helper.Start_Stage(iStage); }
+    ~Stage_Timer(){ if(isActive) helper.Stop_Stage(iStage); }
+  private:
+    PythiaAnalysisHelper &helper;
+    int iStage;
+    bool isActive;
+  };
+
+  // progress telemetry (PROGRESS = interval in seconds): a thread appends one line of key=value pairs per interval to fileName:
+  // time, host, pid, status (running/done), pTHat bin, events done in the bin and in the job, events/s in the last interval,
+  // accepted fraction (not vetoed by MBVeto or the Born veto), projected end (unix time, -1 if unknown) and resident memory.
+  // A job stuck in p.next() (e.g. reading the LHE file) keeps reporting with rate 0; progress_summary.sh summarises a campaign
+  bool Open_Progress(const char *fileName, int interval, long nEventsTotal); // nEventsTotal <= 0: unknown, no projected end
+  void Progress_Bin(int iBin, long nEventsBin); // at the start of a pTHat bin
+  void Progress_Event(){ progressEvents++; } // per generated event
+  void Progress_Veto(){ progressVetoed++; } // per generated event that is vetoed
+  void Close_Progress(); // last line with status=done, ends the thread
+  long Count_LHE_Events(const char *fileName); // number of <event> blocks, -1 if the file cannot be read
+
   double CorrectPhiDelta(double a, double b);
   double XObs_pGoing(PseudoJet &hadronjet, PseudoJet &photonjet, double beamEnergy);
   double XObs_PbGoing(PseudoJet &hadronjet, PseudoJet &photonjet, double beamEnergy);
@@ -56,7 +204,21 @@ class PythiaAnalysisHelper{
   void Fill_ElectronNeg_Pt(Pythia8::Event &event, float etaMax, TH1 *h); // fill pt of all negative electrons
   void Fill_ElectronPos_Pt(Pythia8::Event &event, float etaMax, TH1 *h); // fill pt of all positive electrons = positrons
 
-  // fill invXsec spectra
+  // fill |eta| (or |y| if useRap) vs. pt -> spectra for any acceptance are projected when writing, see Project_Scale_Write2File
+  void Fill_Electron_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h);
+  void Fill_Pi0_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h);
+  void Fill_Pi0Primary_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h);
+  void Fill_Eta_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h);
+  void Fill_EtaPrime_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h);
+  void Fill_Omega_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h);
+  void Fill_Direct_Photon_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h);
+  void Fill_Shower_Photon_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h);
+  void Fill_222_Photon_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h);
+  void Fill_Decay_Photon_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h);
+  void Fill_Direct_Iso_Photon_EtaPt(Pythia8::Event &event, float etaMax, TH2 *h,
+                                    bool isoCharged, double iso_cone_radius, double iso_pt); // iso cone only evaluated for photons within etaMax
+
+  // fill invXsec spectra (standalone; PythiaAnalysis derives them from the 1/pT moments below)
   void Fill_invXsec_Pi0_Pt(Pythia8::Event &event, float etaMax, bool useRap, TH1 *h); // ...if you want to apply 1/(pt*2pi) as weight
   void Fill_invXsec_Pi0Primary_Pt(Pythia8::Event &event, float etaMax, bool useRap, TH1 *h); // ...if you want to apply 1/(pt*2pi) as weight
   void Fill_invXsec_Eta_Pt(Pythia8::Event &event, float etaMax, bool useRap, TH1 *h); // ...if you want to apply 1/(pt*2pi) as weight
@@ -81,9 +243,22 @@ class PythiaAnalysisHelper{
   void Fill_Electron_Pt_ByTopMotherID(Pythia8::Event &event, float etaMax, TH1 *h, std::vector <int> id); // fill electron by topmother id
 
 
+  // 1/pT moments: invariant cross sections derived from the "normal" spectra without a second fill
+  void Book_InvXsec_Moments(std::vector <TH1D*> &vec_temp_histo); // Fill_*_Pt additionally sums 1/pT and 1/pT^2 per pt bin for these histos (index = pTHat bin)
+  void Book_InvXsec_Moments(std::vector <TH2D*> &vec_temp_histo); // same for the |eta| x pt accumulators
+  void Scale_InvXsec_Moments(int iBin, double scale); // same as Scale(sigma) on the histos, for the moments of pTHat bin iBin
+  bool Has_InvXsec_Moments(std::vector <TH1D*> &vec_temp_histo); // true if moments are booked for all histos in vector
+  std::vector <TH1D*> Derive_InvXsec_Histos(std::vector <TH1D*> &vec_temp_histo, TH1* final_histo); // build 1/(2pi pT) weighted bin histos named like final_histo + "_bin_NN"
+
+  // run-time pt binning of the spectra: "default", "Marco", "omega", "eta", "mergedEMCal" or comma separated edges (e.g. "0,1,2,4,8")
+  bool Set_PtBinning(const char *scheme); // false if scheme unknown or edges are not contained in ptBinArrayFine
+
   // post-processing
   //  void Add_Histos_Scale_Write2File( std::vector <TH1D*> &vec_temp_histo, TH1* final_histo, TFile &file, double etaRange, bool useRap, bool isInvariantXsec = false); // not used anymore, marked for deletion
-  void Add_Histos_Scale_Write2File( std::vector <TH1D*> &vec_temp_histo, TH1* final_histo, TFile &file, TDirectory *dir, double etaRange, bool useRap, bool isInvariantXsec = false); // adds temp. histos from pTHat bins to final; normalize for pt bin width and eta range (= no 2*Pi applied here!)
+  void Add_Histos_Scale_Write2File( std::vector <TH1D*> &vec_temp_histo, TH1* final_histo, TFile &file, TDirectory *dir, double etaRange, bool useRap, bool isInvariantXsec = false); // adds temp. histos from pTHat bins to final; normalize for pt bin width and eta range (= no 2*Pi applied here!); isInvariantXsec with booked moments derives the 1/(2pi pT) histos first
+  std::vector <TH1D*> Project_EtaPt(std::vector <TH2D*> &vec_temp_histo, double etaMin, double etaMax, TH1* final_histo); // sum |eta| bins in [etaMin,etaMax) (must be bin edges) incl. 1/pT moments, exact rebinning in pt to final_histo
+  void Project_Scale_Write2File( std::vector <TH2D*> &vec_temp_histo, double etaMin, double etaMax, TH1* final_histo, TFile &file, TDirectory *dir, bool useRap, bool isInvariantXsec = false); // projection + Add_Histos_Scale_Write2File with etaRange = 2*(etaMax-etaMin)
+  void Add_Histos_Write2File( std::vector <TH2D*> &vec_temp_histo, TH2* final_histo, TFile &file, TDirectory *dir, bool isInvariantXsec = false); // |eta| x pt accumulators as cross section per cell (no width scaling) for offline projections
   void Add_Histos_Scale_Write2File_Powheg( std::vector <TH1D>& vec, TFile &file, double invScaleFac);
   void Add_Histos_Scale_Write2File( std::vector <TH2D*> &vec_temp_histo, TH2* final_histo, TFile &file, TDirectory *dir, double etaRange, bool useRap, bool isInvariantXsec = false); // adds temp. histos from pTHat bins to final; normalize for pt bin width and eta range (= no 2*Pi applied here!)
   void FillForEachWeight(vector<TH1D> &vec_h, double val, vector<double> &vec_weights);
@@ -109,6 +284,14 @@ class PythiaAnalysisHelper{
 				 300};
 
 
+  // |eta| binning of the eta x pt accumulators: only the acceptance edges that are projected
+  // (PHOS 0.12, EMCal 0.66, TPC 0.9, etaLarge 3.0, FOCAL 3.3-5.3), the |y| accumulators need only 0.8
+  static const int etaBins = 6;
+  double etaBinArray[etaBins+1] = {0., 0.12, 0.66, 0.9, 3.0, 3.3, 5.3};
+  static const int yBins = 1;
+  double yBinArray[yBins+1] = {0., 0.8};
+
+
   // Erwann/Marco binning
   static const int ptBinsMarco = 9;
   double ptBinArrayMarco[ptBinsMarco+1] = {10., 12., 14., 16., 18.,
@@ -116,26 +299,34 @@ class PythiaAnalysisHelper{
   
   
   // binning for Florian's omega analysis
-  //static const int ptBins = 14;
-  //double ptBinArray[ptBins+1] = {0., 1., 1.4, 1.6, 1.8, 2.0, 2.5, 3.0, 3.5, 4., 5., 6., 8., 12., 16};
-
-  // binning for Florian's omega analysis
-  //  static const int ptBins = 14;
-  //double ptBinArray[ptBins+1] = {0., 1., 1.4, 1.6, 1.8, 2.0, 2.5, 3.0, 3.5, 4., 5., 6., 8., 12., 16};
+  static const int ptBinsOmega = 14;
+  double ptBinArrayOmega[ptBinsOmega+1] = {0., 1., 1.4, 1.6, 1.8, 2.0, 2.5, 3.0, 3.5, 4., 5., 6., 8., 12., 16};
 
   // binning for Florian's eta analysis
-  //static const int ptBins = 13;
-  //double ptBinArray[ptBins+1] = {0.0, 1., 1.2, 1.4, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0, 5.0, 6.0, 8.0, 12.0};
+  static const int ptBinsEta = 13;
+  double ptBinArrayEta[ptBinsEta+1] = {0.0, 1., 1.2, 1.4, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0, 5.0, 6.0, 8.0, 12.0};
 
   // binning for the merged EMCal analysis
-  /*  static const int ptBins = 59;
-  double ptBinArray[ptBins+1] = { 0.0, 0.4, 0.6, 0.8, 1.0, 1.2, 1.4, 1.6, 1.8, 2.0,
-				  2.2, 2.4, 2.6, 3.0, 3.5, 4.0, 4.5, 5.0, 5.5, 6.0,
-				  6.5, 7.0, 7.5, 8.0, 8.5, 9.0, 9.5, 10.0, 11.0, 12.0,
-				  13.0, 14.0, 15.0, 16.0, 17.0, 18.0, 19.0, 20.0, 22.0, 24.0,
-				  26.0, 28.0, 30.0, 32.0, 34.0, 36.0, 38.0, 40.0, 45.0, 50.0,
-				  55.0, 60.0, 65.0, 70.0, 80.0, 100.0, 125.0, 150.0, 175.0, 200.0};
-  */
+  static const int ptBinsMergedEMCal = 59;
+  double ptBinArrayMergedEMCal[ptBinsMergedEMCal+1] = { 0.0, 0.4, 0.6, 0.8, 1.0, 1.2, 1.4, 1.6, 1.8, 2.0,
+							  2.2, 2.4, 2.6, 3.0, 3.5, 4.0, 4.5, 5.0, 5.5, 6.0,
+							  6.5, 7.0, 7.5, 8.0, 8.5, 9.0, 9.5, 10.0, 11.0, 12.0,
+							  13.0, 14.0, 15.0, 16.0, 17.0, 18.0, 19.0, 20.0, 22.0, 24.0,
+							  26.0, 28.0, 30.0, 32.0, 34.0, 36.0, 38.0, 40.0, 45.0, 50.0,
+							  55.0, 60.0, 65.0, 70.0, 80.0, 100.0, 125.0, 150.0, 175.0, 200.0};
+
+  // fine common binning of the spectra accumulators: union of the edges of all schemes above,
+  // so that each of them (or any other subset of these edges) is an exact rebinning
+  static const int ptBinsFine = 108;
+  double ptBinArrayFine[ptBinsFine+1] = {0.0,0.2,0.4,0.6,0.8,1.0,1.2,1.4,1.5,1.6,1.8,2.0,2.2,2.4,2.5,2.6,3.0,3.5,4.0,4.5,5.0,5.5,6.0,6.5,7.0,7.5,8.0,8.5,9.0,9.5,
+					 10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,
+					 30,32,34,35,36,38,40,45,50,55,60,65,70,75,80,85,90,95,100,105,110,115,120,125,130,135,140,145,150,155,160,165,170,175,180,185,190,195,200,205,210,215,220,225,230,235,240,245,250,255,260,265,270,275,280,285,290,295,
+					 300};
+
+  // pt binning of the written spectra, chosen at run time with Set_PtBinning (default: ptBinArray)
+  int ptBinsOut = 0;
+  double ptBinArrayOut[ptBinsFine+1];
+  string ptBinningName = "default";
 
   //  double ptBinArray[ptBins+1];
   /* for(int i=0; i < ptBins+1; i++){ */
@@ -170,6 +361,138 @@ class PythiaAnalysisHelper{
   
  private:
 
+  struct InvXsecMoments{
+    const TH1 *histo; // owner, a clone of it inherits the UniqueID but not the moments
+    int pTHatBin;
+    std::vector<double> sumInvPt;  // sum of w/pT per pt bin (incl. under-/overflow)
+    std::vector<double> sumInvPt2; // sum of w^2/pT^2 per pt bin
+  };
+  std::map<const TH1*, InvXsecMoments> map_invXsecMoments;
+  std::vector<InvXsecMoments*> vec_invXsecMomentsCache; // set at booking, index = UniqueID-1 of the histo -> no map lookup per fill
+
+  string checkpointRandomState; // hex dump of the Pythia random state read by Read_Checkpoint
+
+  // campaign seeding: stream index (task*maxSeedThreads + thread)*maxSeedBins + bin, shifted by a hash of the campaign seed
+  static const int maxSeedThreads = 256;
+  static const int maxSeedBins = 100;
+  bool useCampaignSeed = false;
+  unsigned long long campaignSeed = 0;
+  long campaignTask = 0;
+
+  int mpiRank = 0;
+  int mpiSize = 1;
+  int workerPipe = -1; // fork-server worker: write end of the pipe to the server
+
+  std::vector<TH1*> Get_Histograms_In_Memory(); // TH1D and TH2D in gROOT, same order in all ranks/workers
+  long Get_Histogram_Buffer_Size(std::vector<TH1*> &histos); // number of doubles sent per rank/worker
+  bool Read_Worker_Histograms(int fd, std::vector<TH1*> &histos); // adds the histograms of a worker, false if incomplete
+
+  time_t deadline = 0; // 0: no time limit
+  time_t binDeadline = 0;
+
+  bool Check_Booking_MPI(std::vector<TH1*> &histos, const char *caller); // same histograms and sizes in all ranks
+  void Submit_Checkpoint(std::vector< std::pair<string, TObject*> > &snapshot, string tmp, string target, int iBin, int iEvent);
+
+  void Run_Writer();
+  void Submit_Write_Job(std::function<void()> job, long bytes = 0); // runs job right away if the writer is not started
+  void Reserve_Writer_Queue(long bytes); // blocks while the queued copies would exceed writerQueueMaxBytes
+  std::thread writerThread;
+  std::mutex writerMutex; // protects the queue and the flags below
+  std::condition_variable writerCond;
+  std::deque< std::pair<std::function<void()>, long> > writerQueue; // job, bytes reserved for its copy
+  long writerQueueBytes = 0; // copies queued or being written
+  static const long writerQueueMaxBytes = 256L*1024*1024; // bounds the copies in memory at the write tail
+  bool writerBusy = false;
+  bool writerStop = false;
+  std::mutex outputMutex; // held by the writer during a job; the main thread takes it for direct file accesses (mkdir, README)
+
+  // columns of the event store, shared by writing and replay
+  static const int maxStoredParticles = 20000;
+  static const int maxStoredWeights = 1000;
+  struct StoredEvent{
+    Int_t iBin, nPart, nWeights;
+    Float_t pTHat, x1, x2, eB;
+    Float_t weights[maxStoredWeights];
+    Int_t id[maxStoredParticles], mother1[maxStoredParticles], mother2[maxStoredParticles];
+    Short_t status[maxStoredParticles], statusTopCopy[maxStoredParticles];
+    Float_t pT[maxStoredParticles], eta[maxStoredParticles], phi[maxStoredParticles], m[maxStoredParticles];
+  };
+  StoredEvent *stored = 0;
+  void Set_Store_Branches(TTree *tree, bool isWriting);
+  TFile *storeFile = 0;
+  TTree *storeTree = 0;
+  double storeEtaMax = -1.;
+  TChain *replayChain = 0;
+  std::vector< std::vector< std::pair<Long64_t,Long64_t> > > replayRanges; // per pTHat bin: entry ranges [first,last)
+  std::vector<Long64_t> replayBinEvents, replayFirst, replayNext, replayEnd; // per pTHat bin: all events; first, next and end event of the chunk (counted in the bin)
+
+  struct WeightLogEntry{
+    Long64_t iEvent, seed;
+    Int_t iBin, nWeights;
+    Float_t pTHat, uborns, photonPt;
+    Double_t weights[maxStoredWeights];
+    Bool_t vetoed;
+  };
+  WeightLogEntry *weightLogEntry = 0;
+  TFile *weightLogFile = 0;
+  TTree *weightLogTree = 0;
+
+  static const int nPerfCounters = 4; // cycles, instructions, cache misses, branch misses
+  struct TimingBin{
+    Int_t iBin;
+    Double_t wallTime; // s, from Start_Timing_Bin to the next one
+    Double_t seconds[nTimingStages];
+    Long64_t calls[nTimingStages];
+    Long64_t nEvents, nParticles, nFills, nIsoQueries;
+    Long64_t perf[nTimingStages][nPerfCounters];
+  };
+  bool useTiming = false;
+  std::vector<TimingBin> timingBins; // the last one is running
+  std::chrono::steady_clock::time_point timingBinStart;
+  std::chrono::steady_clock::time_point stageStart[nTimingStages];
+  // counters of the running bin, incremented unconditionally (cheaper than testing useTiming)
+  Long64_t nTimedEvents = 0, nScannedParticles = 0, nHistoFills = 0, nIsoQueries = 0;
+  void Close_Timing_Bin();
+
+  bool usePerf = false;
+  int perfFd[nPerfCounters] = {-1, -1, -1, -1}; // one group, perfFd[0] is the leader
+  unsigned long long perfStart[nTimingStages][nPerfCounters];
+  bool Read_Perf_Counters(unsigned long long *values); // scaled up if the group was multiplexed with other events
+
+  void Run_Progress();
+  void Write_Progress_Line(const char *status, time_t now, double rate);
+  std::thread progressThread;
+  std::mutex progressMutex; // protects progressStop
+  std::condition_variable progressCond;
+  bool progressStop = false;
+  FILE *progressFile = 0;
+  int progressInterval = 0;
+  long progressTotal = 0;
+  time_t progressStart = 0;
+  std::atomic<long> progressEvents{0}, progressVetoed{0}, progressBinFirst{0}, progressBinTotal{0}; // updated by the main thread
+  std::atomic<int> progressBin{-1};
+
+  InvXsecMoments *Find_InvXsec_Moments(const TH1 *h); // NULL if nothing booked for h
+  void Book_InvXsec_Moments(TH1 *h, int iBin);
+  TH1 *Derive_InvXsec_Histo(TH1 *h, TH1 *final_histo, int iBin); // clone of final_histo filled from the moments of h
+  void Fill_Pt(TH1 *h, InvXsecMoments *mom, double pt); // fill h and, if booked, the 1/pT moments
+  void Fill_EtaPt(TH2 *h, InvXsecMoments *mom, double etaAbs, double pt);
+
+  // particle selections shared by the Fill_*_EtaPt functions
+  typedef bool (PythiaAnalysisHelper::*ParticleSelection)(Pythia8::Event &event, int i);
+  void Fill_EtaPt(Pythia8::Event &event, float etaMax, bool useRap, TH2 *h, ParticleSelection isSelected);
+  bool Is_Electron(Pythia8::Event &event, int i);
+  bool Is_Pi0(Pythia8::Event &event, int i);
+  bool Is_Pi0Primary(Pythia8::Event &event, int i);
+  bool Is_Eta(Pythia8::Event &event, int i);
+  bool Is_EtaPrime(Pythia8::Event &event, int i);
+  bool Is_Omega(Pythia8::Event &event, int i);
+  bool Is_Direct_Photon(Pythia8::Event &event, int i);
+  bool Is_Shower_Photon(Pythia8::Event &event, int i);
+  bool Is_222_Photon(Pythia8::Event &event, int i);
+  bool Is_Decay_Photon(Pythia8::Event &event, int i);
+  double IsoCone_Pt(Pythia8::Event &event, int i, bool isoCharged, double iso_cone_radius); // sum of (charged) pt around particle i
+
 };
 
 #endif
@@ -41,6 +41,25 @@ BOOSTZ=$7
 PDF1=$8
 PDF2=$9
 
+# energy scan: comma separated cm energies (e.g. "2760,5020,7000,13000") run one after the other in the same array task,
+# each in its own py8events_<E>GeV directory with its own campaign seed (SEED + index) and its share of the time left
+if [[ "${CMENERGY}" == *,* ]]; then
+    IFS=, read -r -a ENERGIES <<< "${CMENERGY}"
+    for ENERGY in "${ENERGIES[@]}"; do
+        if ! [[ "${ENERGY}" =~ ^[0-9]+(\.[0-9]+)?$ ]]; then
+            echo "\"${ENERGY}\" in \"${CMENERGY}\" is no cm energy in GeV"
+            exit 1
+        fi
+    done
+    BASESEED=${SEED:-${SLURM_ARRAY_JOB_ID}}
+    STATUS=0
+    for (( IENERGY=0; IENERGY<${#ENERGIES[@]}; IENERGY++ )); do
+        echo "energy scan: eCM = ${ENERGIES[IENERGY]} GeV ($((IENERGY+1)) of ${#ENERGIES[@]})"
+        SEED=$((BASESEED + IENERGY)) ENERGIESLEFT=$((${#ENERGIES[@]} - IENERGY)) bash "$0" ${PROCESS} ${NEVENTS} ${ENERGIES[IENERGY]} "${@:4}" || STATUS=1
+    done
+    exit ${STATUS}
+fi
+
 DATE=$(date +%F)
 
 DIRBASE=./py8events_${CMENERGY}GeV
@@ -94,20 +113,56 @@ sleep 1
 cd $OUTDIR
 sleep 1
 
+# campaign seed: the seeds follow from SEED, the task ID and the pTHat bin, distinct for all tasks of the array;
+# rerun failed tasks with SEED=<job ID of the first submission> sbatch --array=<failed tasks> ... for identical results
+export SEED=${SEED:-${SLURM_ARRAY_JOB_ID}}
+
+# snapshot every 30 min, a requeued task (e.g. sbatch --requeue on preemptible partitions) continues from checkpoint_<task>.root
+export CHECKPOINT=${CHECKPOINT:-1800}
+
+# end the generation gracefully 5 min before the time limit of the job (squeue %L = time left, [D-]HH:MM:SS),
+# in an energy scan the time left is shared by the remaining energies
+TIMELEFT=$(squeue -h -j ${SLURM_JOB_ID} -o %L 2>/dev/null)
+if [[ "${TIMELEFT}" =~ ^[0-9:-]+$ ]]; then
+    DAYS=0
+    if [[ "${TIMELEFT}" == *-* ]]; then
+        DAYS=${TIMELEFT%%-*}
+        TIMELEFT=${TIMELEFT#*-}
+    fi
+    SECONDSLEFT=0
+    IFS=: read -r -a TIMEFIELDS <<< "${TIMELEFT}"
+    for FIELD in "${TIMEFIELDS[@]}"; do
+        SECONDSLEFT=$((SECONDSLEFT*60 + 10#${FIELD}))
+    done
+    DEADLINE=$(((DAYS*86400 + SECONDSLEFT - 300) / ${ENERGIESLEFT:-1}))
+    # less than 5 min left: stop right after the first event instead of reading 0 or less as no deadline
+    if [ ${DEADLINE} -lt 1 ]; then
+        echo "WARNING: only $((DAYS*86400 + SECONDSLEFT)) s left in the allocation, DEADLINE set to 1 s"
+        DEADLINE=1
+    fi
+    export DEADLINE
+fi
+
 time ./PythiaAnalysis  $SLURM_ARRAY_TASK_ID ${PROCESS} ${NEVENTS} ${CMENERGY} ${SHOWEROPT} ${RENSCALE} ${FACSCALE} ${BOOSTZ} ${PDF1} ${PDF2}
 
 
 
 
-# create a merge script for the produced root files and to normalize histos per event
+# create a script to merge the produced root files and normalize histos per event in one pass
 ROOTFILENAME="merged_${PROCESS}.root"
 
 if [[ ! -f do_merge_normalize.sh ]]; then
     touch do_merge_normalize.sh
     cat << EOF >do_merge_normalize.sh
-hadd ${ROOTFILENAME} *.root
-wait
-root -l -q -b -x '${OLDDIR}/macros/normalize_per_event.C("${ROOTFILENAME}")'
+${OLDDIR}/normalize -o ${ROOTFILENAME} [0-9]*.root
+EOF
+fi
+
+# watcher merging the outputs while the array is running (start it right after the first task finished),
+# "normalize watch_${ROOTFILENAME}" gives a preview at any time
+if [[ ! -f do_watch_merge.sh ]]; then
+    cat << EOF >do_watch_merge.sh
+${OLDDIR}/haddav -w "[0-9]*.root" -t ${SLURM_ARRAY_TASK_COUNT} -N ${OLDDIR}/normalize watch_${ROOTFILENAME}
 EOF
 fi
  
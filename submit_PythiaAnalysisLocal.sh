@@ -11,18 +11,18 @@ BOOSTZ=$7
 PDF1=$8
 PDF2=$9
 echo "I MADE IT HERE"
-time ./PythiaAnalysis test.root ${PROCESS} ${NEVENTS} ${CMENERGY} ${SHOWEROPT} ${RENSCALE} ${FACSCALE} ${BOOSTZ} ${PDF1} ${PDF2}
+# numeric output name (<task>.root), as the array jobs, so do_merge_normalize.sh picks it up
+TASK=${SLURM_ARRAY_TASK_ID:-0}
+time ./PythiaAnalysis ${TASK} ${PROCESS} ${NEVENTS} ${CMENERGY} ${SHOWEROPT} ${RENSCALE} ${FACSCALE} ${BOOSTZ} ${PDF1} ${PDF2}
 echo "I MADE IT HERE"
 
-# create a merge script for the produced root files and to normalize histos per event
+# create a script to merge the produced root files and normalize histos per event in one pass
 ROOTFILENAME="merged_${PROCESS}.root"
 
 if [[ ! -f do_merge_normalize.sh ]]; then
     touch do_merge_normalize.sh
     cat << EOF >do_merge_normalize.sh
-hadd ${ROOTFILENAME} *.root
-wait
-root -l -q -b -x './macros/normalize_weightSum.C("${ROOTFILENAME}")'
+./normalize -o ${ROOTFILENAME} [0-9]*.root
 EOF
 fi
  